@@ -11,6 +11,17 @@
  * Includes
  ******************************************************************************/
 #include "ParseFile.h"
+#include "IndexFile.h"
+#include "ShmImage.h"
+#include "CacheImage.h"
+#include "SocketFile.h"
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+#define VIEW_WINDOW        20U  /* Data records shown per page by the viewer */
+#define SERVICE_MAX_READ   4096U /* Largest READ request, in bytes */
+#define SERVICE_MAX_CRC    0x1000000U /* Largest CRC request, in bytes (16 MiB) */
+#define SERVICE_CACHE_MB   64U   /* Default memory bound of the service cache */
 /*******************************************************************************
  * APIs
  ******************************************************************************/
@@ -25,6 +36,90 @@
  * @note:  None
  */
 void APP_Print_Address_Data(uint32_t ABS_Address, uint8_t* dataField);
+
+/*
+ * @name: APP_Print_Record
+ * ----------------------------
+ * @brief: Prints one data record with its ID, in the columns of APP_Print_Address_Data
+ * @param[out] ID: The ID of the data record
+ * @param[out] ABS_Address: The absolute address to be printed
+ * @param[out] dataField: Pointer to the data field to be printed
+ * @reVal: None
+ * @note:  None
+ */
+void APP_Print_Record(uint32_t ID, uint32_t ABS_Address, uint8_t* dataField);
+
+/*
+ * @name: APP_View_File
+ * ----------------------------
+ * @brief: Interactive viewer: shows VIEW_WINDOW data records at a time and reads commands
+ *         from stdin (n: next page, p: previous page, g <hex>: go to address, i <id>: go to
+ *         record ID, q: quit). Only the records on screen are decoded; the index used for
+ *         jumps is built while waiting for the next command.
+ * @param[out] fileName: The name of the file to be viewed
+ * @reVal: None
+ * @note:  The file is not checked up front, a broken record is reported when it is reached.
+ */
+void APP_View_File(const char* fileName);
+
+/*
+ * @name: APP_Print_Check_Error
+ * ----------------------------
+ * @brief: Prints the error found by PF_Check_File
+ * @param[out] checkFile: The value returned by PF_Check_File
+ * @reVal: None
+ * @note:  Nothing is printed for CHECK_FILE_SUCCESSFUL.
+ */
+void APP_Print_Check_Error(ParseLine_t checkFile);
+
+/*
+ * @name: APP_Print_Watch_Error
+ * ----------------------------
+ * @brief: Prints the failing record that stops PF_Watch_File
+ * @param[out] checkLine: The check that failed
+ * @param[out] offset: The byte offset of the record
+ * @reVal: None
+ * @note:  CHECK_FILE_FAILED is printed as a file that can't be read.
+ */
+void APP_Print_Watch_Error(ParseLine_t checkLine, int64_t offset);
+
+/*
+ * @name: APP_Print_Error_List
+ * ----------------------------
+ * @brief: Prints the failing records collected by PF_Collect_Errors, one per line
+ * @param[out] errorList: Pointer to the list to be printed
+ * @reVal: None
+ * @note:  Expected and found checksums are only shown for checksum errors.
+ */
+void APP_Print_Error_List(const PF_Error_List_t* errorList);
+
+/*
+ * @name: APP_Publish_Image
+ * ----------------------------
+ * @brief: Publishes the decoded image of a checked file in shared memory and prints its summary
+ * @param[out] fileName: The name of the file, it must have passed PF_Check_File
+ * @param[out] shmName: The name of the shared-memory object
+ * @reVal: None
+ * @note:  Consumers map the image with SI_Open (ShmImage.h).
+ */
+void APP_Publish_Image(const char* fileName, const char* shmName);
+
+/*
+ * @name: APP_Serve
+ * ----------------------------
+ * @brief: Long-running service: answers requests on a Unix domain socket from images kept
+ *         in a CacheImage cache. One request per line, one response line per request:
+ *         - "VALIDATE <file>"               -> "OK" or "ERR <reason>"
+ *         - "READ <file> <hex address> <n>" -> "OK <2n hex digits>" (n <= SERVICE_MAX_READ)
+ *         - "CRC <file> <hex address> <n>"  -> "OK <CRC-32 as 8 hex digits>" (n <= SERVICE_MAX_CRC)
+ *         Addresses held by no record read as IMG_ERASED_BYTE.
+ * @param[out] socketPath: The path of the socket
+ * @param[out] maxBytes: Upper bound of the memory held by cached images
+ * @reVal: None, returns only if the socket can't be created or waiting on it fails
+ * @note:  File paths can't contain spaces. Up to SOCKET_MAX_CLIENT clients stay connected,
+ *         their requests are answered in turn.
+ */
+void APP_Serve(const char* socketPath, const uint32_t maxBytes);
 #endif /* INC_APP_INTEL_HEX_ */
 /*******************************************************************************
  * EOF
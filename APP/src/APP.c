@@ -9,15 +9,347 @@
  * Includes
  ******************************************************************************/
 #include "APP.h"
+#include <poll.h>
+#include <unistd.h>
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static char g_response[2 * SERVICE_MAX_READ + 64];
+static char g_requestPath[CACHE_MAX_PATH];
+static uint8_t g_readBuff[SERVICE_MAX_READ];
 /*******************************************************************************
  * Function Prototypes
  ******************************************************************************/
 void APP_Print_Address_Data(uint32_t ABS_Address, uint8_t* dataField)
 {
     static uint32_t ID = 1;
-    printf("%-5d %-30X %-60s\n", ID, ABS_Address, dataField);
+    APP_Print_Record(ID, ABS_Address, dataField);
     ID++;
 }
+
+void APP_Print_Record(uint32_t ID, uint32_t ABS_Address, uint8_t* dataField)
+{
+    printf("%-5d %-30X %-60s\n", ID, ABS_Address, dataField);
+}
+
+void APP_Print_Check_Error(ParseLine_t checkFile)
+{
+    switch (checkFile)
+    {
+        case CHECK_FILE_SUCCESSFUL:
+            break;
+        case CHECK_START_FAILED:
+            printf("Error: Start Field\n");
+            break;
+        case CHECK_SYNTAX_ASCII_FAILED:
+            printf("Error: Syntax\n");
+            break;
+        case CHECK_SUM_FAILED:
+            printf("Error: Checksum Field\n");
+            break;
+        case CHECK_RECORD_TYPE_FAILED:
+            printf("Error: Type Field\n");
+            break;
+        case CHECK_BYTE_COUNT_FAILED:
+            printf("Error: Bytecount Field\n");
+            break;
+        case CHECK_EOF_FAILED:
+            printf("Error: No Found EOF Record\n");
+            break;
+        default:
+            printf("Error: No found file or can't open your file");
+            break;
+    }
+}
+
+void APP_Publish_Image(const char* fileName, const char* shmName)
+{
+    SI_Image_t image;
+    uint32_t   generation = 0;
+
+    if ((SI_Publish(fileName, shmName, &generation) == SHM_PUBLISH_SUCCESSFUL) &&
+        (SI_Open(shmName, &image) == SHM_OPEN_SUCCESSFUL))
+    {
+        printf("Published %s as %s: generation %u, %u segments, %u bytes\n", fileName, shmName, generation,
+               SI_Num_Of_Segment(&image), SI_Data_Size(&image));
+        SI_Close(&image);
+    } else {
+        printf("Error: Can't publish your file in shared memory\n");
+    }
+}
+
+/*
+ * @name: APP_View_Page
+ * ----------------------------
+ * @brief: Prints the page of records starting at a cursor
+ * @param[out] fileName: The name of the file to be viewed
+ * @param[out] top: The cursor on the first record of the page
+ * @param[in] next: Pointer to the cursor where the position after the page will be stored
+ * @reVal: CHECK_FILE_SUCCESSFUL if the page is full and more records may follow,
+ *         the status of PF_Read_Window otherwise
+ */
+static ParseLine_t APP_View_Page(const char* fileName, const PF_Cursor_t top, PF_Cursor_t* next)
+{
+    ParseLine_t reVal = CHECK_FILE_FAILED;
+
+    *next = top;
+    printf("%-5s %-30s %-60s\n", "ID", "Absolute Memory Address", "Data Field");
+    reVal = PF_Read_Window(fileName, next, VIEW_WINDOW, APP_Print_Record);
+    switch (reVal)
+    {
+        case CHECK_FILE_SUCCESSFUL:
+            break;
+        case CHECK_EOF_FAILED:
+            printf("(End of file)\n");
+            break;
+        case CHECK_FILE_FAILED:
+            printf("Error: No found file or can't open your file\n");
+            break;
+        default:
+            printf("Error: Invalid record at byte offset %lld\n", (long long)next->offset);
+            break;
+    }
+
+    return reVal;
+}
+
+void APP_View_File(const char* fileName)
+{
+    PF_Cursor_t   top;
+    PF_Cursor_t   next;
+    ParseLine_t   pageStatus  = CHECK_FILE_FAILED;
+    IndexFile_t   indexStatus = INDEX_BUILD_IN_PROGRESS;
+    char          Command[64];
+    uint32_t      value       = 0;
+    uint8_t       Quit        = false;
+    struct pollfd pollFd;
+
+    if (IF_Init(fileName) == INDEX_INIT_SUCCESSFUL)
+    {
+        top.offset      = 0;
+        top.ID          = 1;
+        top.typeExtend  = DATA_RECORD;
+        top.valueExtend = 0;
+        pageStatus = APP_View_Page(fileName, top, &next);
+
+        pollFd.fd     = STDIN_FILENO;
+        pollFd.events = POLLIN;
+        while (Quit == false)
+        {
+            printf("[n]ext [p]rev [g <hex address>] [i <ID>] [q]uit: ");
+            fflush(stdout);
+
+            /* Build the index while no command is pending */
+            while ((indexStatus == INDEX_BUILD_IN_PROGRESS) && (poll(&pollFd, 1, 0) == 0))
+            {
+                indexStatus = IF_Build_Step();
+            }
+
+            if (fgets(Command, sizeof(Command), stdin) == NULL)
+            {
+                Quit = true;
+            } else if ((Command[0] == 'n') || (Command[0] == '\n')) {
+                if (pageStatus == CHECK_FILE_SUCCESSFUL)
+                {
+                    top = next;
+                } else {
+
+                }
+                pageStatus = APP_View_Page(fileName, top, &next);
+            } else if (Command[0] == 'p') {
+                if (IF_Find_ID((top.ID > VIEW_WINDOW) ? (top.ID - VIEW_WINDOW) : 1, &top) == INDEX_FIND_SUCCESSFUL)
+                {
+                    pageStatus = APP_View_Page(fileName, top, &next);
+                } else {
+
+                }
+            } else if (sscanf(Command, "g %x", &value) == 1) {
+                if (IF_Find_Address(value, &top) == INDEX_FIND_SUCCESSFUL)
+                {
+                    pageStatus = APP_View_Page(fileName, top, &next);
+                } else {
+                    printf("Error: No record holds address %X\n", value);
+                }
+            } else if (sscanf(Command, "i %u", &value) == 1) {
+                if (IF_Find_ID(value, &top) == INDEX_FIND_SUCCESSFUL)
+                {
+                    pageStatus = APP_View_Page(fileName, top, &next);
+                } else {
+                    printf("Error: No record with ID %u\n", value);
+                }
+            } else if (Command[0] == 'q') {
+                Quit = true;
+            } else {
+
+            }
+        }
+
+        IF_DeInit();
+    } else {
+
+    }
+}
+
+/*
+ * @name: APP_Check_Name
+ * ----------------------------
+ * @brief: Gets a one-word name for a failed PF_Check_File, used by the service and the error list
+ * @param[out] checkFile: The value returned by PF_Check_File
+ * @reVal: The reason, one word
+ */
+static const char* APP_Check_Name(ParseLine_t checkFile)
+{
+    const char* reVal = "FILE";
+
+    switch (checkFile)
+    {
+        case CHECK_START_FAILED:
+            reVal = "START";
+            break;
+        case CHECK_SYNTAX_ASCII_FAILED:
+            reVal = "SYNTAX";
+            break;
+        case CHECK_SUM_FAILED:
+            reVal = "CHECKSUM";
+            break;
+        case CHECK_RECORD_TYPE_FAILED:
+            reVal = "TYPE";
+            break;
+        case CHECK_BYTE_COUNT_FAILED:
+            reVal = "BYTECOUNT";
+            break;
+        case CHECK_EOF_FAILED:
+            reVal = "NO_EOF";
+            break;
+        default:
+            reVal = "FILE";
+            break;
+    }
+
+    return reVal;
+}
+
+/*
+ * @name: APP_Serve_Request
+ * ----------------------------
+ * @brief: Answers one service request into g_response
+ * @param[out] Request: Pointer to the request line, without "\r\n"
+ * @reVal: None
+ */
+static void APP_Serve_Request(const char* Request)
+{
+    char          Command[16];
+    uint32_t      address   = 0;
+    uint32_t      length    = 0;
+    uint32_t      crc       = 0;
+    uint32_t      index     = 0;
+    int32_t       numOfArg  = 0;
+    ParseLine_t   checkFile = CHECK_FILE_FAILED;
+    CacheImage_t  cache     = CACHE_GET_FAILED;
+    const uint8_t* pImage   = NULL;
+    const IMG_Map_t* pMap  = NULL;
+
+    numOfArg = sscanf(Request, "%15s %4095s %x %u", Command, g_requestPath, &address, &length);
+    if (numOfArg >= 2)
+    {
+        cache = CI_Get(g_requestPath, &checkFile, &pImage, &pMap);
+    } else {
+
+    }
+
+    if (numOfArg < 2)
+    {
+        strcpy(g_response, "ERR REQUEST\n");
+    } else if (cache == CACHE_GET_FAILED) {
+        strcpy(g_response, "ERR NO_FILE\n");
+    } else if (checkFile != CHECK_FILE_SUCCESSFUL) {
+        sprintf(g_response, "ERR %s\n", APP_Check_Name(checkFile));
+    } else if (strcmp(Command, "VALIDATE") == 0) {
+        strcpy(g_response, "OK\n");
+    } else if (cache == CACHE_GET_TOO_LARGE) {
+        strcpy(g_response, "ERR TOO_LARGE\n");
+    } else if ((numOfArg == 4) && (strcmp(Command, "READ") == 0)) {
+        if ((length <= SERVICE_MAX_READ) && (IMG_Read(pImage, address, length, g_readBuff) == IMAGE_READ_SUCCESSFUL))
+        {
+            strcpy(g_response, "OK ");
+            for (index = 0; index < length; ++index)
+            {
+                sprintf(&g_response[3 + index * 2], "%02X", g_readBuff[index]);
+            }
+            strcpy(&g_response[3 + length * 2], "\n");
+        } else {
+            strcpy(g_response, "ERR RANGE\n");
+        }
+    } else if ((numOfArg == 4) && (strcmp(Command, "CRC") == 0)) {
+        if ((length <= SERVICE_MAX_CRC) && (IMG_Get_CRC32(pImage, pMap, address, length, &crc) == IMAGE_READ_SUCCESSFUL))
+        {
+            sprintf(g_response, "OK %08X\n", crc);
+        } else {
+            strcpy(g_response, "ERR RANGE\n");
+        }
+    } else {
+        strcpy(g_response, "ERR REQUEST\n");
+    }
+}
+
+void APP_Serve(const char* socketPath, const uint32_t maxBytes)
+{
+    char     Request[MAX_SOCKET_LINE];
+    uint32_t client = 0;
+
+    if ((CI_Init(maxBytes) == CACHE_INIT_SUCCESSFUL) && (SF_Init(socketPath) == SOCKET_INIT_SUCCESSFUL))
+    {
+        printf("Serving on %s, cache bound %u bytes\n", socketPath, maxBytes);
+        fflush(stdout);
+        while (SF_Read_Line(&client, Request) == SOCKET_READ_SUCCESSFUL)
+        {
+            /* A client that can't take its response is dropped by SF_Write */
+            APP_Serve_Request(Request);
+            SF_Write(client, g_response, strlen(g_response));
+        }
+        SF_DeInit();
+    } else {
+
+    }
+    printf("Error: Can't serve on %s\n", (socketPath != NULL) ? socketPath : "");
+    CI_DeInit();
+}
+
+void APP_Print_Error_List(const PF_Error_List_t* errorList)
+{
+    uint32_t          index  = 0;
+    const PF_Error_t* pError = NULL;
+
+    printf("%-8s %-12s %-10s %-9s %-6s\n", "Line", "Byte Offset", "Error", "Expected", "Found");
+    for (index = 0; index < errorList->numOfEntry; ++index)
+    {
+        pError = &errorList->entry[index];
+        if (pError->kind == CHECK_SUM_FAILED)
+        {
+            printf("%-8u %-12lld %-10s %-9.2X %-6.2X\n", pError->line, (long long)pError->offset, APP_Check_Name(pError->kind),
+                   pError->expectedSum, pError->foundSum);
+        } else {
+            printf("%-8u %-12lld %-10s\n", pError->line, (long long)pError->offset, APP_Check_Name(pError->kind));
+        }
+    }
+    if (errorList->numOfError > errorList->numOfEntry)
+    {
+        printf("... and %u more errors\n", errorList->numOfError - errorList->numOfEntry);
+    } else {
+
+    }
+    printf("%u error(s)\n", errorList->numOfError);
+}
+
+void APP_Print_Watch_Error(ParseLine_t checkLine, int64_t offset)
+{
+    if (checkLine == CHECK_FILE_FAILED)
+    {
+        printf("Error: No found file or can't open your file\n");
+    } else {
+        printf("Error: %s at byte offset %lld, waiting for the record to be fixed\n", APP_Check_Name(checkLine), (long long)offset);
+    }
+}
 /*******************************************************************************
  * EOF
  ******************************************************************************/
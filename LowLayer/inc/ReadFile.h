@@ -29,6 +29,10 @@ typedef enum {
     FILE_DEINIT_FAILED,
     READ_LINE_SUCCESSFUL,
     READ_LINE_FAILED,
+    FILE_SEEK_SUCCESSFUL,
+    FILE_SEEK_FAILED,
+    READ_BLOCK_SUCCESSFUL,
+    READ_BLOCK_FAILED,
 } ReadFile_t;
 /*******************************************************************************
  * APIs
@@ -61,6 +65,35 @@ extern ReadFile_t RF_DeInit(void);
            - READ_LINE_FAILED if there was an error reading the line or if Buff is NULL.
  */
 extern ReadFile_t Read_Line(uint8_t* Buff);
+/*
+ * @name: RF_Seek
+ * ----------------------------
+ * @brief: Moves the read position of the opened file to the given byte offset
+ * @param[out] offset: The byte offset from the beginning of the file
+ * @reVal: - FILE_SEEK_SUCCESSFUL if the read position was moved
+           - FILE_SEEK_FAILED if no file is opened, the offset is negative or can't be reached
+ */
+extern ReadFile_t RF_Seek(const int64_t offset);
+/*
+ * @name: RF_Tell
+ * ----------------------------
+ * @brief: Gets the current read position of the opened file
+ * @param[in] offset: Pointer to the variable where the byte offset will be stored
+ * @reVal: - FILE_SEEK_SUCCESSFUL if the read position was stored
+           - FILE_SEEK_FAILED if no file is opened or if offset is NULL
+ */
+extern ReadFile_t RF_Tell(int64_t* offset);
+/*
+ * @name: RF_Read_Block
+ * ----------------------------
+ * @brief: Reads up to size raw bytes from the current read position
+ * @param[in] Buff: Pointer to the buffer where the bytes will be stored
+ * @param[out] size: Maximum number of bytes to read
+ * @param[in] readSize: Pointer to the variable where the number of bytes read will be stored
+ * @reVal: - READ_BLOCK_SUCCESSFUL if at least one byte was read
+           - READ_BLOCK_FAILED if the end of file was reached or if Buff/readSize is NULL
+ */
+extern ReadFile_t RF_Read_Block(uint8_t* Buff, const uint32_t size, uint32_t* readSize);
 #endif /* INC_READ_FILE_INTEL_HEX_ */
 /*******************************************************************************
  * EOF
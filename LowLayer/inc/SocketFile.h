@@ -0,0 +1,94 @@
+/*
+ * SocketFile.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+#ifndef INC_SOCKET_FILE_INTEL_HEX_
+#define INC_SOCKET_FILE_INTEL_HEX_
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+#define MAX_SOCKET_LINE    4224U /* Longest request line, path included */
+#define SOCKET_BACKLOG     16
+#define SOCKET_MAX_CLIENT  32U   /* Clients connected at the same time */
+#define SOCKET_TIMEOUT_S   5     /* An idle client is dropped after this many seconds */
+/*******************************************************************************
+ * Typedef structs & enums
+ ******************************************************************************/
+typedef enum {
+    SOCKET_INIT_SUCCESSFUL,
+    SOCKET_INIT_FAILED,
+    SOCKET_DEINIT_SUCCESSFUL,
+    SOCKET_DEINIT_FAILED,
+    SOCKET_READ_SUCCESSFUL,
+    SOCKET_READ_FAILED,
+    SOCKET_WRITE_SUCCESSFUL,
+    SOCKET_WRITE_FAILED,
+} SocketFile_t;
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+/*
+ * @name: SF_Init
+ * ----------------------------
+ * @brief: Creates a Unix domain stream socket listening on the given path
+ * @param[out] socketPath: The path of the socket, a stale socket left there is replaced
+ * @reVal: - SOCKET_INIT_SUCCESSFUL if the socket is listening
+           - SOCKET_INIT_FAILED if the path is too long, taken by another file, or if socketPath is NULL
+ */
+extern SocketFile_t SF_Init(const char* socketPath);
+/*
+ * @name: SF_DeInit
+ * ----------------------------
+ * @brief: Closes the listening socket and removes its path
+ * @param: None
+ * @reVal: - SOCKET_DEINIT_SUCCESSFUL if the socket was closed
+           - SOCKET_DEINIT_FAILED if no socket was listening
+ */
+extern SocketFile_t SF_DeInit(void);
+/*
+ * @name: SF_Close_Client
+ * ----------------------------
+ * @brief: Disconnects a client
+ * @param[out] client: The client, as given by SF_Read_Line
+ * @reVal: None
+ */
+extern void SF_Close_Client(const uint32_t client);
+/*
+ * @name: SF_Read_Line
+ * ----------------------------
+ * @brief: Waits for the next '\n' terminated line from any client, without the "\r\n".
+ *         New clients are accepted and idle ones dropped while waiting; clients with a
+ *         line ready take turns so one busy client can't hold the others back.
+ * @param[in] client: Pointer to the variable where the client that sent the line will be stored
+ * @param[in] Buff: Pointer to a buffer of MAX_SOCKET_LINE bytes where the line will be stored
+ * @reVal: - SOCKET_READ_SUCCESSFUL if a line was read
+           - SOCKET_READ_FAILED if no socket is listening, waiting failed or if a pointer is NULL
+ * @note: A client sending a line longer than MAX_SOCKET_LINE is dropped.
+ */
+extern SocketFile_t SF_Read_Line(uint32_t* client, char* Buff);
+/*
+ * @name: SF_Write
+ * ----------------------------
+ * @brief: Sends bytes to a client without waiting
+ * @param[out] client: The client, as given by SF_Read_Line
+ * @param[out] Buff: Pointer to the bytes to be sent
+ * @param[out] length: Number of bytes to be sent
+ * @reVal: - SOCKET_WRITE_SUCCESSFUL if every byte was sent
+           - SOCKET_WRITE_FAILED if the client is gone or if Buff is NULL
+ * @note: A client that lets its replies pile up past the socket buffer is dropped.
+ */
+extern SocketFile_t SF_Write(const uint32_t client, const char* Buff, const uint32_t length);
+#endif /* INC_SOCKET_FILE_INTEL_HEX_ */
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
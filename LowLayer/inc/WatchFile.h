@@ -0,0 +1,69 @@
+/*
+ * WatchFile.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+#ifndef INC_WATCH_FILE_INTEL_HEX_
+#define INC_WATCH_FILE_INTEL_HEX_
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+#define MAX_WATCH_PATH     4096U
+#define WATCH_SETTLE_MS    20    /* Quiet time before a burst of events is reported */
+/*******************************************************************************
+ * Typedef structs & enums
+ ******************************************************************************/
+typedef enum {
+    WATCH_INIT_SUCCESSFUL,
+    WATCH_INIT_FAILED,
+    WATCH_DEINIT_SUCCESSFUL,
+    WATCH_DEINIT_FAILED,
+    WATCH_EVENT_CHANGED,
+    WATCH_EVENT_FAILED,
+} WatchFile_t;
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+/*
+ * @name: WF_Init
+ * ----------------------------
+ * @brief: Starts watching the specified file for changes (inotify, Linux only)
+ * @param[out] fileName: The name of the file to be watched
+ * @reVal: - WATCH_INIT_SUCCESSFUL if the watch was registered
+           - WATCH_INIT_FAILED if inotify is unavailable or if fileName is NULL
+ * @note: The parent directory is watched rather than the file itself, so a file that
+ *        is replaced (written to a temporary file then renamed) is still followed.
+ */
+extern WatchFile_t WF_Init(const char* fileName);
+/*
+ * @name: WF_DeInit
+ * ----------------------------
+ * @brief: Stops watching the file registered by WF_Init
+ * @param: None
+ * @reVal: - WATCH_DEINIT_SUCCESSFUL if the watch was released
+           - WATCH_DEINIT_FAILED if no watch was registered
+ */
+extern WatchFile_t WF_DeInit(void);
+/*
+ * @name: WF_Wait_Change
+ * ----------------------------
+ * @brief: Blocks until the watched file is written, created or replaced
+ * @param: None
+ * @reVal: - WATCH_EVENT_CHANGED if the file was changed
+           - WATCH_EVENT_FAILED if no watch was registered or reading the events failed
+ * @note: Events arriving within WATCH_SETTLE_MS of each other are reported once.
+ */
+extern WatchFile_t WF_Wait_Change(void);
+#endif /* INC_WATCH_FILE_INTEL_HEX_ */
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
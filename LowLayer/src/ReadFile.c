@@ -8,7 +8,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#define _FILE_OFFSET_BITS 64 /* 64-bit off_t for fseeko/ftello on 32-bit targets as well */
 #include "ReadFile.h"
+#include <sys/types.h>
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -74,6 +76,70 @@ ReadFile_t Read_Line(uint8_t* Buff)
 
     return reVal;
 }
+
+ReadFile_t RF_Seek(const int64_t offset)
+{
+    ReadFile_t reVal      = FILE_SEEK_FAILED;
+    int32_t    statusSeek = -1;
+
+    /* Refuse an offset off_t can't hold rather than seek to a truncated one */
+    if ((pFile != NULL) && (offset >= 0) && ((int64_t)(off_t)offset == offset))
+    {
+        statusSeek = fseeko(pFile, (off_t)offset, SEEK_SET);
+        if (statusSeek == 0)
+        {
+            reVal = FILE_SEEK_SUCCESSFUL;
+        } else {
+            reVal = FILE_SEEK_FAILED;
+        }
+    } else {
+        reVal = FILE_SEEK_FAILED;
+    }
+
+    return reVal;
+}
+
+ReadFile_t RF_Tell(int64_t* offset)
+{
+    ReadFile_t reVal    = FILE_SEEK_FAILED;
+    off_t      position = 0;
+
+    if ((pFile != NULL) && (offset != NULL))
+    {
+        position = ftello(pFile);
+        if (position >= 0)
+        {
+            *offset = (int64_t)position;
+            reVal = FILE_SEEK_SUCCESSFUL;
+        } else {
+            reVal = FILE_SEEK_FAILED;
+        }
+    } else {
+        reVal = FILE_SEEK_FAILED;
+    }
+
+    return reVal;
+}
+
+ReadFile_t RF_Read_Block(uint8_t* Buff, const uint32_t size, uint32_t* readSize)
+{
+    ReadFile_t reVal = READ_BLOCK_FAILED;
+
+    if ((pFile != NULL) && (Buff != NULL) && (readSize != NULL))
+    {
+        *readSize = fread(Buff, 1, size, pFile);
+        if (*readSize > 0)
+        {
+            reVal = READ_BLOCK_SUCCESSFUL;
+        } else {
+            reVal = READ_BLOCK_FAILED;
+        }
+    } else {
+        reVal = READ_BLOCK_FAILED;
+    }
+
+    return reVal;
+}
 /*******************************************************************************
  * EOF
  ******************************************************************************/
@@ -0,0 +1,391 @@
+/*
+ * SocketFile.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "SocketFile.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+#define SOCKET_POLL_MS     1000  /* Longest wait before idle clients are checked again */
+/*******************************************************************************
+ * Typedef structs & enums
+ ******************************************************************************/
+typedef struct {
+    int32_t fd;                      /* -1 while the slot is free */
+    char    rxBuff[MAX_SOCKET_LINE]; /* Bytes received but not returned yet */
+    size_t  rxLength;
+    time_t  lastActive;              /* Monotonic seconds of the last byte received */
+} SF_Client_t;
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static int32_t     g_listenFd = -1;
+static char        g_socketPath[sizeof(((struct sockaddr_un*)0)->sun_path)];
+static SF_Client_t g_client[SOCKET_MAX_CLIENT];
+static uint32_t    g_nextClient = 0;        /* Client looked at first for the next line */
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+SocketFile_t SF_Init(const char* socketPath)
+{
+    SocketFile_t       reVal = SOCKET_INIT_FAILED;
+    struct sockaddr_un address;
+    struct stat        status;
+    uint32_t           index = 0;
+
+    if ((socketPath != NULL) && (strlen(socketPath) < sizeof(address.sun_path)) && (g_listenFd < 0))
+    {
+        /* Replace a socket left by a previous run, never another kind of file */
+        if ((lstat(socketPath, &status) == 0) && S_ISSOCK(status.st_mode))
+        {
+            unlink(socketPath);
+        } else {
+
+        }
+
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        strcpy(address.sun_path, socketPath);
+        g_listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if ((g_listenFd >= 0) && (bind(g_listenFd, (struct sockaddr*)&address, sizeof(address)) == 0) &&
+            (listen(g_listenFd, SOCKET_BACKLOG) == 0))
+        {
+            strcpy(g_socketPath, socketPath);
+            for (index = 0; index < SOCKET_MAX_CLIENT; ++index)
+            {
+                g_client[index].fd       = -1;
+                g_client[index].rxLength = 0;
+            }
+            reVal = SOCKET_INIT_SUCCESSFUL;
+        } else {
+            if (g_listenFd >= 0)
+            {
+                close(g_listenFd);
+                g_listenFd = -1;
+            } else {
+
+            }
+            reVal = SOCKET_INIT_FAILED;
+        }
+    } else {
+        reVal = SOCKET_INIT_FAILED;
+    }
+
+    return reVal;
+}
+
+SocketFile_t SF_DeInit(void)
+{
+    SocketFile_t reVal = SOCKET_DEINIT_FAILED;
+    uint32_t     index = 0;
+
+    if (g_listenFd >= 0)
+    {
+        for (index = 0; index < SOCKET_MAX_CLIENT; ++index)
+        {
+            SF_Close_Client(index);
+        }
+        close(g_listenFd);
+        unlink(g_socketPath);
+        g_listenFd = -1;
+        reVal = SOCKET_DEINIT_SUCCESSFUL;
+    } else {
+        reVal = SOCKET_DEINIT_FAILED;
+    }
+
+    return reVal;
+}
+
+/*
+ * @name: SF_Now
+ * ----------------------------
+ * @brief: Gets the time from a clock that never jumps back
+ * @param: None
+ * @reVal: Monotonic time in seconds
+ */
+static time_t SF_Now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec;
+}
+
+/*
+ * @name: SF_Accept
+ * ----------------------------
+ * @brief: Accepts every pending client into a free slot
+ * @param: None
+ * @reVal: None
+ */
+static void SF_Accept(void)
+{
+    int32_t  clientFd = -1;
+    uint32_t index    = 0;
+    uint8_t  Stop     = 0U;
+
+    while (Stop == 0U)
+    {
+        for (index = 0; (index < SOCKET_MAX_CLIENT) && (g_client[index].fd >= 0); ++index)
+        {
+
+        }
+        if (index == SOCKET_MAX_CLIENT)
+        {
+            /* The rest wait in the backlog until a slot is released */
+            Stop = 1U;
+        } else {
+            clientFd = accept(g_listenFd, NULL, NULL);
+            if (clientFd >= 0)
+            {
+                fcntl(clientFd, F_SETFD, FD_CLOEXEC);
+                fcntl(clientFd, F_SETFL, O_NONBLOCK);
+                g_client[index].fd         = clientFd;
+                g_client[index].rxLength   = 0;
+                g_client[index].lastActive = SF_Now();
+            } else if (errno != EINTR) {
+                Stop = 1U;
+            } else {
+
+            }
+        }
+    }
+}
+
+/*
+ * @name: SF_Receive
+ * ----------------------------
+ * @brief: Appends what a client sent to its buffer, drops the client if it closed,
+ *         failed or filled its buffer without ending a line
+ * @param[out] client: The client
+ * @reVal: None
+ */
+static void SF_Receive(const uint32_t client)
+{
+    SF_Client_t* pClient = &g_client[client];
+    ssize_t      length  = 0;
+
+    length = recv(pClient->fd, &pClient->rxBuff[pClient->rxLength], sizeof(pClient->rxBuff) - pClient->rxLength, 0);
+    if (length > 0)
+    {
+        pClient->rxLength  += length;
+        pClient->lastActive = SF_Now();
+        if ((pClient->rxLength == sizeof(pClient->rxBuff)) && (memchr(pClient->rxBuff, '\n', pClient->rxLength) == NULL))
+        {
+            SF_Close_Client(client);
+        } else {
+
+        }
+    } else if ((length < 0) && ((errno == EINTR) || (errno == EAGAIN) || (errno == EWOULDBLOCK))) {
+
+    } else {
+        SF_Close_Client(client);
+    }
+}
+
+/*
+ * @name: SF_Take_Line
+ * ----------------------------
+ * @brief: Moves the first complete line of a client to Buff, without the "\r\n"
+ * @param[out] client: The client
+ * @param[in] Buff: Pointer to a buffer of MAX_SOCKET_LINE bytes
+ * @reVal: - SOCKET_READ_SUCCESSFUL if the client had a complete line
+           - SOCKET_READ_FAILED otherwise
+ */
+static SocketFile_t SF_Take_Line(const uint32_t client, char* Buff)
+{
+    SocketFile_t reVal    = SOCKET_READ_FAILED;
+    SF_Client_t* pClient  = &g_client[client];
+    char*        pNewLine = NULL;
+    size_t       lineSize = 0;
+
+    if (pClient->fd >= 0)
+    {
+        pNewLine = memchr(pClient->rxBuff, '\n', pClient->rxLength);
+    } else {
+
+    }
+
+    if (pNewLine != NULL)
+    {
+        /* Hand out one line and keep what follows it */
+        lineSize = pNewLine - pClient->rxBuff;
+        memcpy(Buff, pClient->rxBuff, lineSize);
+        Buff[lineSize] = '\0';
+        if ((lineSize > 0) && (Buff[lineSize - 1] == '\r'))
+        {
+            Buff[lineSize - 1] = '\0';
+        } else {
+
+        }
+        pClient->rxLength -= lineSize + 1;
+        memmove(pClient->rxBuff, pNewLine + 1, pClient->rxLength);
+        reVal = SOCKET_READ_SUCCESSFUL;
+    } else {
+        reVal = SOCKET_READ_FAILED;
+    }
+
+    return reVal;
+}
+
+void SF_Close_Client(const uint32_t client)
+{
+    if ((client < SOCKET_MAX_CLIENT) && (g_client[client].fd >= 0))
+    {
+        close(g_client[client].fd);
+        g_client[client].fd = -1;
+    } else {
+
+    }
+    if (client < SOCKET_MAX_CLIENT)
+    {
+        g_client[client].rxLength = 0;
+    } else {
+
+    }
+}
+
+SocketFile_t SF_Read_Line(uint32_t* client, char* Buff)
+{
+    SocketFile_t  reVal      = SOCKET_READ_FAILED;
+    struct pollfd pollSet[SOCKET_MAX_CLIENT + 1];
+    uint32_t      pollSlot[SOCKET_MAX_CLIENT + 1]; /* Client of each entry, SOCKET_MAX_CLIENT for the listener */
+    uint32_t      numOfPoll  = 0;
+    uint32_t      index      = 0;
+    uint32_t      slot       = 0;
+    int32_t       numOfReady = 0;
+    time_t        now        = 0;
+    uint8_t       Stop       = 0U;
+
+    if ((client != NULL) && (Buff != NULL) && (g_listenFd >= 0))
+    {
+        while (Stop == 0U)
+        {
+            /* Serve a line already received, starting after the client served last */
+            for (index = 0; (index < SOCKET_MAX_CLIENT) && (Stop == 0U); ++index)
+            {
+                slot = (g_nextClient + index) % SOCKET_MAX_CLIENT;
+                if (SF_Take_Line(slot, Buff) == SOCKET_READ_SUCCESSFUL)
+                {
+                    *client      = slot;
+                    g_nextClient = (slot + 1) % SOCKET_MAX_CLIENT;
+                    reVal = SOCKET_READ_SUCCESSFUL;
+                    Stop  = 1U;
+                } else {
+
+                }
+            }
+
+            if (Stop == 0U)
+            {
+                /* Listen for new clients only while a slot is free */
+                numOfPoll = 0;
+                for (index = 0; index < SOCKET_MAX_CLIENT; ++index)
+                {
+                    if (g_client[index].fd >= 0)
+                    {
+                        pollSet[numOfPoll].fd     = g_client[index].fd;
+                        pollSet[numOfPoll].events = POLLIN;
+                        pollSlot[numOfPoll]       = index;
+                        numOfPoll++;
+                    } else {
+
+                    }
+                }
+                if (numOfPoll < SOCKET_MAX_CLIENT)
+                {
+                    pollSet[numOfPoll].fd     = g_listenFd;
+                    pollSet[numOfPoll].events = POLLIN;
+                    pollSlot[numOfPoll]       = SOCKET_MAX_CLIENT;
+                    numOfPoll++;
+                } else {
+
+                }
+
+                numOfReady = poll(pollSet, numOfPoll, SOCKET_POLL_MS);
+                if (numOfReady > 0)
+                {
+                    for (index = 0; index < numOfPoll; ++index)
+                    {
+                        if (pollSet[index].revents == 0)
+                        {
+
+                        } else if (pollSlot[index] == SOCKET_MAX_CLIENT) {
+                            SF_Accept();
+                        } else {
+                            SF_Receive(pollSlot[index]);
+                        }
+                    }
+                } else if ((numOfReady < 0) && (errno != EINTR)) {
+                    Stop = 1U;
+                } else {
+
+                }
+
+                now = SF_Now();
+                for (index = 0; index < SOCKET_MAX_CLIENT; ++index)
+                {
+                    if ((g_client[index].fd >= 0) && (now - g_client[index].lastActive >= SOCKET_TIMEOUT_S))
+                    {
+                        SF_Close_Client(index);
+                    } else {
+
+                    }
+                }
+            } else {
+
+            }
+        }
+    } else {
+        reVal = SOCKET_READ_FAILED;
+    }
+
+    return reVal;
+}
+
+SocketFile_t SF_Write(const uint32_t client, const char* Buff, const uint32_t length)
+{
+    SocketFile_t reVal = SOCKET_WRITE_SUCCESSFUL;
+    uint32_t     done  = 0;
+    ssize_t      sent  = 0;
+
+    if ((Buff != NULL) && (client < SOCKET_MAX_CLIENT) && (g_client[client].fd >= 0))
+    {
+        while ((done < length) && (reVal == SOCKET_WRITE_SUCCESSFUL))
+        {
+            sent = send(g_client[client].fd, &Buff[done], length - done, MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (sent > 0)
+            {
+                done += sent;
+            } else if ((sent < 0) && (errno == EINTR)) {
+
+            } else {
+                /* Waiting on a client that doesn't read would hold every other client */
+                SF_Close_Client(client);
+                reVal = SOCKET_WRITE_FAILED;
+            }
+        }
+    } else {
+        reVal = SOCKET_WRITE_FAILED;
+    }
+
+    return reVal;
+}
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,168 @@
+/*
+ * WatchFile.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "WatchFile.h"
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+#define WATCH_EVENT_MASK   (IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO)
+#define WATCH_EVENT_BUFF   (sizeof(struct inotify_event) + MAX_WATCH_PATH + 1)
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static int32_t g_inotifyFd  = -1;
+static int32_t g_watchFd    = -1;
+static char    g_watchDir[MAX_WATCH_PATH];
+static char    g_watchName[MAX_WATCH_PATH];
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+
+/*
+ * @name: WF_Read_Events
+ * ----------------------------
+ * @brief: Reads one batch of pending inotify events
+ * @param: None
+ * @reVal: - 1 if one of the events concerns the watched file
+           - 0 if none of them does
+           - -1 if reading the events failed
+ */
+static int32_t WF_Read_Events(void)
+{
+    int32_t                     reVal  = 0;
+    uint8_t                     Buff[WATCH_EVENT_BUFF] __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t                     length = 0;
+    ssize_t                     index  = 0;
+    const struct inotify_event* pEvent = NULL;
+
+    length = read(g_inotifyFd, Buff, sizeof(Buff));
+    if (length > 0)
+    {
+        for (index = 0; index < length; index += sizeof(struct inotify_event) + pEvent->len)
+        {
+            pEvent = (const struct inotify_event*)&Buff[index];
+            if ((pEvent->len > 0) && (strcmp(pEvent->name, g_watchName) == 0))
+            {
+                reVal = 1;
+            } else {
+
+            }
+        }
+    } else {
+        reVal = -1;
+    }
+
+    return reVal;
+}
+
+WatchFile_t WF_Init(const char* fileName)
+{
+    WatchFile_t reVal  = WATCH_INIT_FAILED;
+    const char* pSlash = NULL;
+
+    if ((fileName != NULL) && (strlen(fileName) < MAX_WATCH_PATH) && (g_inotifyFd < 0))
+    {
+        /* Split the path into the directory to watch and the name to filter on */
+        pSlash = strrchr(fileName, '/');
+        if (pSlash != NULL)
+        {
+            memcpy(g_watchDir, fileName, pSlash - fileName);
+            g_watchDir[pSlash - fileName] = '\0';
+            if (g_watchDir[0] == '\0')
+            {
+                strcpy(g_watchDir, "/");
+            } else {
+
+            }
+            strcpy(g_watchName, pSlash + 1);
+        } else {
+            strcpy(g_watchDir, ".");
+            strcpy(g_watchName, fileName);
+        }
+
+        g_inotifyFd = inotify_init1(IN_CLOEXEC);
+        if (g_inotifyFd >= 0)
+        {
+            g_watchFd = inotify_add_watch(g_inotifyFd, g_watchDir, WATCH_EVENT_MASK);
+            if (g_watchFd >= 0)
+            {
+                reVal = WATCH_INIT_SUCCESSFUL;
+            } else {
+                close(g_inotifyFd);
+                g_inotifyFd = -1;
+                reVal = WATCH_INIT_FAILED;
+            }
+        } else {
+            reVal = WATCH_INIT_FAILED;
+        }
+    } else {
+        reVal = WATCH_INIT_FAILED;
+    }
+
+    return reVal;
+}
+
+WatchFile_t WF_DeInit(void)
+{
+    WatchFile_t reVal = WATCH_DEINIT_FAILED;
+
+    if (g_inotifyFd >= 0)
+    {
+        inotify_rm_watch(g_inotifyFd, g_watchFd);
+        close(g_inotifyFd);
+        g_inotifyFd = -1;
+        g_watchFd   = -1;
+        reVal = WATCH_DEINIT_SUCCESSFUL;
+    } else {
+        reVal = WATCH_DEINIT_FAILED;
+    }
+
+    return reVal;
+}
+
+WatchFile_t WF_Wait_Change(void)
+{
+    WatchFile_t   reVal   = WATCH_EVENT_FAILED;
+    int32_t       status  = 0;
+    struct pollfd pollFd;
+
+    if (g_inotifyFd >= 0)
+    {
+        /* Block until the watched file shows up in an event */
+        do
+        {
+            status = WF_Read_Events();
+        } while (status == 0);
+
+        if (status > 0)
+        {
+            /* Swallow the rest of the burst, a writer usually emits many events */
+            pollFd.fd     = g_inotifyFd;
+            pollFd.events = POLLIN;
+            while ((poll(&pollFd, 1, WATCH_SETTLE_MS) > 0) && (WF_Read_Events() >= 0))
+            {
+
+            }
+            reVal = WATCH_EVENT_CHANGED;
+        } else {
+            reVal = WATCH_EVENT_FAILED;
+        }
+    } else {
+        reVal = WATCH_EVENT_FAILED;
+    }
+
+    return reVal;
+}
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,90 @@
+/*
+ * CacheImage.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+#ifndef INC_CACHE_IMAGE_INTEL_HEX_
+#define INC_CACHE_IMAGE_INTEL_HEX_
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ImageFile.h"
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+#define CACHE_MAX_ENTRY    32U   /* Files remembered at once, valid or not */
+#define CACHE_MAX_PATH     4096U
+/*******************************************************************************
+ * Typedef structs & enums
+ ******************************************************************************/
+typedef enum {
+    CACHE_INIT_SUCCESSFUL,
+    CACHE_INIT_FAILED,
+    CACHE_GET_HIT,          /* Served from memory */
+    CACHE_GET_LOADED,       /* Parsed now, the file was new or changed */
+    CACHE_GET_FAILED,       /* No such file */
+    CACHE_GET_TOO_LARGE,    /* Valid file whose image exceeds the memory bound */
+} CacheImage_t;
+
+/*
+ * @name: CI_Entry_t
+ * ----------------------------
+ * @brief: A file known to the cache. The stat fields identify the version of the file
+ *         the entry was built from.
+ */
+typedef struct {
+    char        path[CACHE_MAX_PATH];   /* Resolved path, empty if the slot is free */
+    int64_t     mtimeSec;
+    int64_t     mtimeNsec;
+    int64_t     size;
+    uint64_t    inode;
+    ParseLine_t checkFile;              /* Result of PF_Check_File */
+    uint8_t*    image;                  /* Decoded image, NULL unless checkFile is CHECK_FILE_SUCCESSFUL */
+    IMG_Map_t   map;                    /* Run table of the image, for CRC requests */
+    uint32_t    imageSize;              /* Bytes of the image and of its run table */
+    uint32_t    lastUse;                /* Tick of the last request, for LRU eviction */
+} CI_Entry_t;
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+/*
+ * @name: CI_Init
+ * ----------------------------
+ * @brief: Starts an empty cache
+ * @param[out] maxBytes: Upper bound of the memory held by the cached images
+ * @reVal: - CACHE_INIT_SUCCESSFUL if the cache was started
+           - CACHE_INIT_FAILED if maxBytes is 0
+ */
+extern CacheImage_t CI_Init(const uint32_t maxBytes);
+/*
+ * @name: CI_DeInit
+ * ----------------------------
+ * @brief: Releases every cached image
+ * @param: None
+ * @reVal: None
+ */
+extern void CI_DeInit(void);
+/*
+ * @name: CI_Get
+ * ----------------------------
+ * @brief: Gets the check result and the decoded image of a file. The file is parsed on its
+ *         first request and again only when its mtime, size or inode changes. The least
+ *         recently used images are dropped to stay within the memory bound.
+ * @param[out] fileName: The name of the file
+ * @param[in] checkFile: Pointer to the variable where the result of PF_Check_File will be stored
+ * @param[in] image: Pointer to the variable where the image will be stored, NULL if the file is invalid
+ * @param[in] map: Pointer to the variable where the map of the image will be stored, NULL with the image
+ * @reVal: - CACHE_GET_HIT or CACHE_GET_LOADED if checkFile (and image, map) were stored
+           - CACHE_GET_TOO_LARGE if the file is valid but its image can't fit, image and map are NULL
+           - CACHE_GET_FAILED if the file can't be found or if a pointer is NULL
+ * @note: The image and map stay valid until the next call to CI_Get or CI_DeInit.
+ *        The run table of the map is counted in the memory bound with the image.
+ */
+extern CacheImage_t CI_Get(const char* fileName, ParseLine_t* checkFile, const uint8_t** image, const IMG_Map_t** map);
+#endif /* INC_CACHE_IMAGE_INTEL_HEX_ */
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
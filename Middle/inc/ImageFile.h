@@ -0,0 +1,115 @@
+/*
+ * ImageFile.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+#ifndef INC_IMAGE_FILE_INTEL_HEX_
+#define INC_IMAGE_FILE_INTEL_HEX_
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ParseFile.h"
+#include "ImageFormat.h"
+/*******************************************************************************
+ * Typedef structs & enums
+ ******************************************************************************/
+typedef enum {
+    IMAGE_BUILD_SUCCESSFUL,
+    IMAGE_BUILD_FAILED,
+    IMAGE_READ_SUCCESSFUL,
+    IMAGE_READ_FAILED,
+} ImageFile_t;
+
+/*
+ * @name: IMG_Map_t
+ * ----------------------------
+ * @brief: Address-sorted view of an image: each run is the part of a segment that is not
+ *         overwritten by a later record, and runs don't overlap. Built once per image so
+ *         range queries need no sorting.
+ */
+typedef struct {
+    IMG_Segment_t* run;         /* dataOffset is relative to the image, as in the segment table */
+    uint32_t       numOfRun;
+} IMG_Map_t;
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+/*
+ * @name: IMG_Measure
+ * ----------------------------
+ * @brief: Computes the layout of the decoded image of an input file
+ * @param[out] fileName: The name of the file to be decoded
+ * @param[in] header: Pointer to the header to be filled, totalSize is the size to allocate
+ * @reVal: - IMAGE_BUILD_SUCCESSFUL if the layout was computed
+           - IMAGE_BUILD_FAILED if fileName/header is NULL or if the image would not fit in
+             UINT32_MAX bytes
+ * @note: The file must have passed PF_Check_File. The generation field is set to 0.
+ */
+extern ImageFile_t IMG_Measure(const char* fileName, IMG_Header_t* header);
+/*
+ * @name: IMG_Build
+ * ----------------------------
+ * @brief: Decodes an input file into an image: header, segment table and data bytes
+ * @param[out] fileName: The name of the file to be decoded
+ * @param[in] image: Pointer to a buffer of header->totalSize bytes
+ * @param[out] header: The layout computed by IMG_Measure
+ * @reVal: - IMAGE_BUILD_SUCCESSFUL if the image was written
+           - IMAGE_BUILD_FAILED if the file no longer matches the layout or if a pointer is NULL
+ * @note: The generation field of the image is left untouched for the caller.
+ */
+extern ImageFile_t IMG_Build(const char* fileName, uint8_t* image, const IMG_Header_t* header);
+/*
+ * @name: IMG_Read
+ * ----------------------------
+ * @brief: Copies a range of absolute addresses out of an image
+ * @param[out] image: Pointer to an image written by IMG_Build
+ * @param[out] address: The absolute address of the first byte
+ * @param[out] length: Number of bytes to be copied
+ * @param[in] Buff: Pointer to the buffer where the bytes will be stored
+ * @reVal: - IMAGE_READ_SUCCESSFUL if the bytes were copied
+           - IMAGE_READ_FAILED if the range wraps past 0xFFFFFFFF or if a pointer is NULL
+ * @note: Bytes held by no record read as IMG_ERASED_BYTE. Where records overlap, the
+ *        last one in file order wins, as it would when flashing.
+ */
+extern ImageFile_t IMG_Read(const uint8_t* image, const uint32_t address, const uint32_t length, uint8_t* Buff);
+/*
+ * @name: IMG_Map_Init
+ * ----------------------------
+ * @brief: Builds the address-sorted run table of an image
+ * @param[out] image: Pointer to an image written by IMG_Build
+ * @param[in] map: Pointer to the map to be filled
+ * @reVal: - IMAGE_BUILD_SUCCESSFUL if the map was built
+           - IMAGE_BUILD_FAILED if memory ran out or if a pointer is NULL
+ * @note: The run table takes numOfRun * sizeof(IMG_Segment_t) bytes, at most twice the
+ *        segment table. Release it with IMG_Map_DeInit.
+ */
+extern ImageFile_t IMG_Map_Init(const uint8_t* image, IMG_Map_t* map);
+/*
+ * @name: IMG_Map_DeInit
+ * ----------------------------
+ * @brief: Releases the run table of a map
+ * @param[in] map: Pointer to the map, may be NULL
+ * @reVal: None
+ */
+extern void IMG_Map_DeInit(IMG_Map_t* map);
+/*
+ * @name: IMG_Get_CRC32
+ * ----------------------------
+ * @brief: Computes the CRC-32 (IEEE 802.3, as zlib) of a range of absolute addresses of an image
+ * @param[out] image: Pointer to an image written by IMG_Build
+ * @param[out] map: Pointer to the map built from the image by IMG_Map_Init
+ * @param[out] address: The absolute address of the first byte
+ * @param[out] length: Number of bytes in the range
+ * @param[in] crc: Pointer to the variable where the CRC will be stored
+ * @reVal: - IMAGE_READ_SUCCESSFUL if the CRC was computed
+           - IMAGE_READ_FAILED if the range wraps past 0xFFFFFFFF or if a pointer is NULL
+ * @note: Bytes held by no record count as IMG_ERASED_BYTE. Nothing is allocated.
+ */
+extern ImageFile_t IMG_Get_CRC32(const uint8_t* image, const IMG_Map_t* map, const uint32_t address, const uint32_t length, uint32_t* crc);
+#endif /* INC_IMAGE_FILE_INTEL_HEX_ */
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,53 @@
+/*
+ * ImageFormat.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+#ifndef INC_IMAGE_FORMAT_INTEL_HEX_
+#define INC_IMAGE_FORMAT_INTEL_HEX_
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+#define IMG_MAGIC          0x58454849U /* "IHEX" */
+#define IMG_VERSION        1U
+#define IMG_ERASED_BYTE    0xFFU /* Value read where no record holds data */
+/*******************************************************************************
+ * Typedef structs & enums
+ ******************************************************************************/
+
+/*
+ * @name: IMG_Header_t
+ * ----------------------------
+ * @brief: Start of a decoded image. The image is laid out as:
+ *         IMG_Header_t | IMG_Segment_t[numOfSegment] | data bytes
+ *         and only holds offsets, so it can be mapped at any address.
+ */
+typedef struct {
+    uint32_t magic;         /* IMG_MAGIC */
+    uint32_t version;       /* IMG_VERSION */
+    uint32_t generation;    /* Bumped on every publish, odd while the image is being written */
+    uint32_t numOfSegment;
+    uint32_t dataSize;      /* Total number of data bytes */
+    uint32_t totalSize;     /* Size of the whole image in bytes */
+} IMG_Header_t;
+
+/*
+ * @name: IMG_Segment_t
+ * ----------------------------
+ * @brief: A run of data records whose addresses follow each other, in file order
+ */
+typedef struct {
+    uint32_t address;       /* Absolute address of the first byte */
+    uint32_t length;        /* Number of bytes */
+    uint32_t dataOffset;    /* Offset of the first byte from the start of the image */
+} IMG_Segment_t;
+#endif /* INC_IMAGE_FORMAT_INTEL_HEX_ */
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,100 @@
+/*
+ * IndexFile.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+#ifndef INC_INDEX_FILE_INTEL_HEX_
+#define INC_INDEX_FILE_INTEL_HEX_
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ParseFile.h"
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+#define INDEX_STRIDE       256U /* Data records covered by one index entry */
+/*******************************************************************************
+ * Typedef structs & enums
+ ******************************************************************************/
+typedef enum {
+    INDEX_INIT_SUCCESSFUL,
+    INDEX_INIT_FAILED,
+    INDEX_BUILD_IN_PROGRESS,
+    INDEX_BUILD_DONE,
+    INDEX_FIND_SUCCESSFUL,
+    INDEX_FIND_FAILED,
+} IndexFile_t;
+
+/*
+ * @name: IF_Entry_t
+ * ----------------------------
+ * @brief: One entry of the sparse index: where a run of INDEX_STRIDE data records starts
+ *         and the range of absolute addresses those records cover
+ */
+typedef struct {
+    PF_Cursor_t cursor;
+    uint32_t    minAddress;
+    uint32_t    maxAddress;
+} IF_Entry_t;
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+/*
+ * @name: IF_Init
+ * ----------------------------
+ * @brief: Starts a new, empty index for the specified file
+ * @param[out] fileName: The name of the file to be indexed
+ * @reVal: - INDEX_INIT_SUCCESSFUL if the index was started
+           - INDEX_INIT_FAILED if fileName is NULL
+ * @note: The file is not read here, the index is filled by IF_Build_Step.
+ */
+extern IndexFile_t IF_Init(const char* fileName);
+/*
+ * @name: IF_DeInit
+ * ----------------------------
+ * @brief: Releases the index
+ * @param: None
+ * @reVal: None
+ */
+extern void IF_DeInit(void);
+/*
+ * @name: IF_Build_Step
+ * ----------------------------
+ * @brief: Extends the index by one entry (INDEX_STRIDE data records)
+ * @param: None
+ * @reVal: - INDEX_BUILD_IN_PROGRESS if more of the file remains to be indexed
+           - INDEX_BUILD_DONE if the whole file is indexed or a record failed validation
+ * @note: Meant to be called while the application is idle, so the index is built in
+ *        the background of an interactive session.
+ */
+extern IndexFile_t IF_Build_Step(void);
+/*
+ * @name: IF_Find_ID
+ * ----------------------------
+ * @brief: Gets a cursor on the data record with the given ID
+ * @param[out] ID: The ID of the data record, the first one is 1
+ * @param[in] cursor: Pointer to the cursor to be set
+ * @reVal: - INDEX_FIND_SUCCESSFUL if the record exists
+           - INDEX_FIND_FAILED if the file has fewer records or if cursor is NULL
+ * @note: The index is extended as far as needed, at most INDEX_STRIDE records are read
+ *        past the nearest entry.
+ */
+extern IndexFile_t IF_Find_ID(const uint32_t ID, PF_Cursor_t* cursor);
+/*
+ * @name: IF_Find_Address
+ * ----------------------------
+ * @brief: Gets a cursor on the first data record (in file order) holding the given absolute address
+ * @param[out] address: The absolute address to be found
+ * @param[in] cursor: Pointer to the cursor to be set
+ * @reVal: - INDEX_FIND_SUCCESSFUL if a record holds the address
+           - INDEX_FIND_FAILED if no record holds it or if cursor is NULL
+ * @note: Only the runs whose address range contains the address are read.
+ */
+extern IndexFile_t IF_Find_Address(const uint32_t address, PF_Cursor_t* cursor);
+#endif /* INC_INDEX_FILE_INTEL_HEX_ */
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
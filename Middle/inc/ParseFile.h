@@ -28,6 +28,8 @@
 #define START_LINEAR              5U
 #define false                     0U
 #define true                      1U
+#define WATCH_BLOCK_SIZE          4096U /* Granularity of the change detection in watch mode */
+#define MAX_ERROR_ENTRY           64U   /* Errors kept by PF_Collect_Errors, later ones are only counted */
 /*******************************************************************************
  * Typedef structs & enums
  ******************************************************************************/
@@ -55,6 +57,47 @@ typedef enum {
 
 typedef void (*func)(uint32_t, uint8_t*);
 
+typedef void (*viewFunc)(uint32_t, uint32_t, uint8_t*); /* Record ID, absolute address, data field */
+
+typedef void (*errorFunc)(ParseLine_t, int64_t); /* Failed check, byte offset of the record */
+
+/*
+ * @name: PF_Cursor_t
+ * ----------------------------
+ * @brief: Position between two records of a file, with everything needed to resume
+ *         decoding from there without reading the records before it
+ */
+typedef struct {
+    int64_t  offset;        /* Byte offset of the next record */
+    uint32_t ID;            /* ID of the next data record, the first one is 1 */
+    uint32_t valueExtend;   /* Extended address value in force at offset */
+    uint8_t  typeExtend;    /* Extended address type in force at offset */
+} PF_Cursor_t;
+
+/*
+ * @name: PF_Error_t
+ * ----------------------------
+ * @brief: One failing record found by PF_Collect_Errors
+ */
+typedef struct {
+    uint32_t line;          /* Line number, the first line is 1 */
+    int64_t  offset;        /* Byte offset of the start of the line */
+    uint8_t  kind;          /* ParseLine_t of the first check that failed */
+    uint8_t  expectedSum;   /* Checksum computed from the record, CHECK_SUM_FAILED only */
+    uint8_t  foundSum;      /* Checksum field of the record, CHECK_SUM_FAILED only */
+} PF_Error_t;
+
+/*
+ * @name: PF_Error_List_t
+ * ----------------------------
+ * @brief: Bounded list of the failing records of a file, in file order
+ */
+typedef struct {
+    PF_Error_t entry[MAX_ERROR_ENTRY];
+    uint32_t   numOfEntry;  /* Entries stored, at most MAX_ERROR_ENTRY */
+    uint32_t   numOfError;  /* Errors found, numOfError - numOfEntry were not stored */
+} PF_Error_List_t;
+
 /*******************************************************************************
  * APIs
  ******************************************************************************/
@@ -73,6 +116,23 @@ typedef void (*func)(uint32_t, uint8_t*);
  */
 extern ParseLine_t PF_Check_File(const char* fileName);
 
+/*
+ * @name: PF_Collect_Errors
+ * ----------------------------
+ * @brief: Same checks as PF_Check_File, but keeps validating after a failing record and
+ *         collects every failing record with its position in a single pass
+ * @param[out] fileName: The name of the file to be checked
+ * @param[in] errorList: Pointer to the list to be filled
+ * @reVal: - CHECK_FILE_SUCCESSFUL if the file passed all checks (the list is empty)
+ *         - CHECK_FILE_FAILED if there was an error opening the file or if fileName/errorList is NULL
+ *         - Otherwise the kind of the first entry of the list
+ * @note: A missing EOF record is reported as a CHECK_EOF_FAILED entry one line past the end.
+ *        A line longer than MAX_CHAR_EACH_LINE is reported once, as CHECK_BYTE_COUNT_FAILED.
+ *        Positions and checksums are only worked out for failing records, so a valid file
+ *        costs the same as with PF_Check_File.
+ */
+extern ParseLine_t PF_Collect_Errors(const char* fileName, PF_Error_List_t* errorList);
+
 /*
  * @name: PF_Export_Data
  * ----------------------------
@@ -87,6 +147,49 @@ extern ParseLine_t PF_Check_File(const char* fileName);
  *        functions can be performed according to user requirements (via callback)
  */
 extern void PF_Export_Data(const char* fileName, func Print_Address_Data);
+
+/*
+ * @name: PF_Watch_File
+ * ----------------------------
+ * @brief: Exports the data of an input file, then keeps watching it and exports the records
+ *         added or changed each time the file is appended to or rewritten.
+ *         - On append, parsing resumes after the last validated record with the extended
+ *           address state saved there.
+ *         - On rewrite, only the WATCH_BLOCK_SIZE blocks whose hash changed are re-validated,
+ *           starting from a checkpoint saved in the block before, until the parse lines up
+ *           with an unchanged block again.
+ *         Every data record is passed with its ID, counted from 1 in file order, so a record
+ *         exported again after a rewrite keeps its ID unless records were added or removed
+ *         before it.
+ * @param[out] fileName: The name of the file to be watched
+ * @param[in] Print_Record: A function pointer to the callback function responsible for printing data
+ * @param[in] Print_Error: A function pointer to the callback function responsible for printing errors
+ * @reVal: CHECK_FILE_FAILED if the file can't be watched or if fileName/Print_Record/Print_Error is NULL.
+ *         The function does not return while the watch is working.
+ * @note: A record that is not terminated yet or fails validation stops the pass; it is
+ *        parsed again at the next change, so a file being regenerated is followed as it grows.
+ *        A failing record is passed to Print_Error with its byte offset, once until the
+ *        failure changes; a line longer than MAX_CHAR_EACH_LINE fails as CHECK_BYTE_COUNT_FAILED.
+ *        CHECK_FILE_FAILED (offset 0) means the file could not be read.
+ *        Linux only (inotify).
+ */
+extern ParseLine_t PF_Watch_File(const char* fileName, viewFunc Print_Record, errorFunc Print_Error);
+
+/*
+ * @name: PF_Read_Window
+ * ----------------------------
+ * @brief: Validates and decodes the data records following a cursor, and only those.
+ *         Used to show a window of a large file without parsing it up front.
+ * @param[out] fileName: The name of the file to be read
+ * @param[in] cursor: Pointer to the position to start from, moved past the records read
+ * @param[out] numOfRecord: Number of data records to be read
+ * @param[in] Print_Record: The callback for each data record, NULL to only move the cursor
+ * @reVal: - CHECK_FILE_SUCCESSFUL if numOfRecord data records were read
+ *         - CHECK_EOF_FAILED if the end of file was reached first
+ *         - CHECK_FILE_FAILED if there was an error opening the file or if fileName/cursor is NULL
+ *         - Other ParseLine_t values if the record at cursor->offset failed validation
+ */
+extern ParseLine_t PF_Read_Window(const char* fileName, PF_Cursor_t* cursor, uint32_t numOfRecord, viewFunc Print_Record);
 #endif /* INC_PARSE_FILE_INTEL_HEX_ */
 /*******************************************************************************
  * EOF
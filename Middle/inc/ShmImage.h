@@ -0,0 +1,146 @@
+/*
+ * ShmImage.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+#ifndef INC_SHM_IMAGE_INTEL_HEX_
+#define INC_SHM_IMAGE_INTEL_HEX_
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ImageFormat.h"
+/*******************************************************************************
+ * Typedef structs & enums
+ ******************************************************************************/
+typedef enum {
+    SHM_PUBLISH_SUCCESSFUL,
+    SHM_PUBLISH_FAILED,
+    SHM_OPEN_SUCCESSFUL,
+    SHM_OPEN_FAILED,
+    SHM_OPEN_BUSY,
+    SHM_CLOSE_SUCCESSFUL,
+    SHM_CLOSE_FAILED,
+    SHM_SEGMENT_SUCCESSFUL,
+    SHM_SEGMENT_FAILED,
+    SHM_IMAGE_CURRENT,
+    SHM_IMAGE_OUTDATED,
+} ShmImage_t;
+
+/*
+ * @name: SI_Image_t
+ * ----------------------------
+ * @brief: A published image mapped read-only by a consumer process
+ */
+typedef struct {
+    const uint8_t* base;        /* Start of the mapping, an IMG_Header_t */
+    uint32_t       size;        /* Size of the mapping in bytes */
+    uint32_t       generation;  /* Generation of the image when it was opened */
+} SI_Image_t;
+/*******************************************************************************
+ * APIs - publisher (ShmPublish.c, needs the parser)
+ ******************************************************************************/
+
+/*
+ * @name: SI_Publish
+ * ----------------------------
+ * @brief: Decodes an input file once and publishes the image as a POSIX shared-memory object
+ * @param[out] fileName: The name of the file to be decoded, it must have passed PF_Check_File
+ * @param[out] shmName: The name of the shared-memory object, e.g. "/intelHex"
+ * @param[in] generation: Pointer to the variable where the new generation will be stored, may be NULL
+ * @reVal: - SHM_PUBLISH_SUCCESSFUL if the image was published
+           - SHM_PUBLISH_FAILED if the object can't be created or the file can't be decoded
+ * @note: An image published earlier under the same name is unlinked, not modified: consumers
+ *        that still map it keep a consistent view and see SI_Is_Current report it outdated.
+ *        The generation continues from the previous image and is odd while writing.
+ */
+extern ShmImage_t SI_Publish(const char* fileName, const char* shmName, uint32_t* generation);
+/*
+ * @name: SI_Unpublish
+ * ----------------------------
+ * @brief: Removes a published image name, existing mappings stay valid until closed
+ * @param[out] shmName: The name of the shared-memory object
+ * @reVal: - SHM_CLOSE_SUCCESSFUL if the name was removed
+           - SHM_CLOSE_FAILED if no image is published under that name
+ */
+extern ShmImage_t SI_Unpublish(const char* shmName);
+/*******************************************************************************
+ * APIs - consumer (ShmImage.c only, no parsing)
+ ******************************************************************************/
+
+/*
+ * @name: SI_Get_Generation
+ * ----------------------------
+ * @brief: Reads the generation of the image currently published under a name
+ * @param[out] shmName: The name of the shared-memory object
+ * @param[in] generation: Pointer to the variable where the generation will be stored
+ * @reVal: - SHM_OPEN_SUCCESSFUL if an image is published under that name
+           - SHM_OPEN_FAILED otherwise or if a pointer is NULL
+ * @note: Only the header is mapped, so it is cheap enough to poll.
+ */
+extern ShmImage_t SI_Get_Generation(const char* shmName, uint32_t* generation);
+/*
+ * @name: SI_Open
+ * ----------------------------
+ * @brief: Maps a published image read-only, without parsing or copying it
+ * @param[out] shmName: The name of the shared-memory object
+ * @param[in] image: Pointer to the image handle to be filled
+ * @reVal: - SHM_OPEN_SUCCESSFUL if the image was mapped
+           - SHM_OPEN_BUSY if the image is still being written, try again later
+           - SHM_OPEN_FAILED if no valid image is published under that name or if a pointer is NULL
+ */
+extern ShmImage_t SI_Open(const char* shmName, SI_Image_t* image);
+/*
+ * @name: SI_Close
+ * ----------------------------
+ * @brief: Unmaps an image opened by SI_Open
+ * @param[in] image: Pointer to the image handle
+ * @reVal: - SHM_CLOSE_SUCCESSFUL if the image was unmapped
+           - SHM_CLOSE_FAILED if the image is not mapped
+ */
+extern ShmImage_t SI_Close(SI_Image_t* image);
+/*
+ * @name: SI_Num_Of_Segment
+ * ----------------------------
+ * @brief: Gets the number of segments of an opened image
+ * @param[out] image: Pointer to the image handle
+ * @reVal: The number of segments, 0 if the image is not mapped
+ */
+extern uint32_t SI_Num_Of_Segment(const SI_Image_t* image);
+/*
+ * @name: SI_Data_Size
+ * ----------------------------
+ * @brief: Gets the total number of data bytes of an opened image, all segments together
+ * @param[out] image: Pointer to the image handle
+ * @reVal: The number of data bytes, 0 if the image is not mapped
+ */
+extern uint32_t SI_Data_Size(const SI_Image_t* image);
+/*
+ * @name: SI_Get_Segment
+ * ----------------------------
+ * @brief: Gets one segment of an opened image, the data points into the mapping
+ * @param[out] image: Pointer to the image handle
+ * @param[out] index: Index of the segment, from 0 to SI_Num_Of_Segment() - 1
+ * @param[in] address: Pointer to the variable where the absolute address will be stored
+ * @param[in] length: Pointer to the variable where the number of bytes will be stored
+ * @param[in] data: Pointer to the variable where the address of the first byte will be stored
+ * @reVal: - SHM_SEGMENT_SUCCESSFUL if the segment was found
+           - SHM_SEGMENT_FAILED if index is out of range, the segment is malformed or a pointer is NULL
+ */
+extern ShmImage_t SI_Get_Segment(const SI_Image_t* image, const uint32_t index, uint32_t* address,
+                                 uint32_t* length, const uint8_t** data);
+/*
+ * @name: SI_Is_Current
+ * ----------------------------
+ * @brief: Checks whether an opened image is still the one published under its name
+ * @param[out] shmName: The name of the shared-memory object
+ * @param[out] image: Pointer to the image handle
+ * @reVal: - SHM_IMAGE_CURRENT if the name still holds the same generation
+           - SHM_IMAGE_OUTDATED if a newer image was published or the name was removed
+ */
+extern ShmImage_t SI_Is_Current(const char* shmName, const SI_Image_t* image);
+#endif /* INC_SHM_IMAGE_INTEL_HEX_ */
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,238 @@
+/*
+ * CacheImage.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "CacheImage.h"
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static CI_Entry_t g_cacheEntry[CACHE_MAX_ENTRY];
+static uint32_t   g_maxBytes  = 0;
+static uint32_t   g_usedBytes = 0;  /* Sum of imageSize over the entries */
+static uint32_t   g_tick      = 0;
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+
+/*
+ * @name: CI_Release
+ * ----------------------------
+ * @brief: Frees the image of an entry and marks its slot free
+ * @param[in] pEntry: Pointer to the entry to be released
+ * @reVal: None
+ */
+static void CI_Release(CI_Entry_t* pEntry)
+{
+    free(pEntry->image);
+    IMG_Map_DeInit(&pEntry->map);
+    g_usedBytes      -= pEntry->imageSize;
+    pEntry->image     = NULL;
+    pEntry->imageSize = 0;
+    pEntry->path[0]   = '\0';
+}
+
+/*
+ * @name: CI_Evict_LRU
+ * ----------------------------
+ * @brief: Releases the least recently used entry
+ * @param[out] pKeep: Pointer to an entry that must not be released, may be NULL
+ * @param[out] imageOnly: true to only consider entries holding an image
+ * @reVal: Pointer to the released slot, NULL if no entry could be released
+ */
+static CI_Entry_t* CI_Evict_LRU(const CI_Entry_t* pKeep, const uint8_t imageOnly)
+{
+    CI_Entry_t* pOldest = NULL;
+    uint32_t    index   = 0;
+
+    for (index = 0; index < CACHE_MAX_ENTRY; ++index)
+    {
+        if ((&g_cacheEntry[index] != pKeep) && (g_cacheEntry[index].path[0] != '\0') &&
+            ((imageOnly == false) || (g_cacheEntry[index].image != NULL)) &&
+            ((pOldest == NULL) || (g_tick - g_cacheEntry[index].lastUse > g_tick - pOldest->lastUse)))
+        {
+            pOldest = &g_cacheEntry[index];
+        } else {
+
+        }
+    }
+
+    if (pOldest != NULL)
+    {
+        CI_Release(pOldest);
+    } else {
+
+    }
+
+    return pOldest;
+}
+
+/*
+ * @name: CI_Load
+ * ----------------------------
+ * @brief: Checks a file and decodes it into an entry, evicting images to make room
+ * @param[in] pEntry: Pointer to the entry, its path and stat fields already set
+ * @reVal: - CACHE_GET_LOADED if the entry was filled
+           - CACHE_GET_TOO_LARGE if the file is valid but its image can't fit
+           - CACHE_GET_FAILED if the file changed while being decoded or memory ran out
+ */
+static CacheImage_t CI_Load(CI_Entry_t* pEntry)
+{
+    CacheImage_t reVal     = CACHE_GET_LOADED;
+    IMG_Header_t header;
+    uint64_t     needBytes = 0;
+
+    pEntry->checkFile = PF_Check_File(pEntry->path);
+    if (pEntry->checkFile != CHECK_FILE_SUCCESSFUL)
+    {
+
+    } else if (IMG_Measure(pEntry->path, &header) != IMAGE_BUILD_SUCCESSFUL) {
+        /* IMG_Measure only fails here if the image can't be described in 32 bits */
+        reVal = CACHE_GET_TOO_LARGE;
+    } else {
+        /* Room for the image and the largest run table it can have */
+        needBytes = header.totalSize + (2 * (uint64_t)header.numOfSegment + 1) * sizeof(IMG_Segment_t);
+        if (needBytes > g_maxBytes)
+        {
+            reVal = CACHE_GET_TOO_LARGE;
+        } else {
+            /* g_usedBytes never exceeds g_maxBytes, the difference can't wrap */
+            while ((needBytes > g_maxBytes - g_usedBytes) && (CI_Evict_LRU(pEntry, true) != NULL))
+            {
+
+            }
+
+            pEntry->image = malloc(header.totalSize);
+            if ((pEntry->image != NULL) && (IMG_Build(pEntry->path, pEntry->image, &header) == IMAGE_BUILD_SUCCESSFUL) &&
+                (IMG_Map_Init(pEntry->image, &pEntry->map) == IMAGE_BUILD_SUCCESSFUL))
+            {
+                pEntry->imageSize = header.totalSize + (pEntry->map.numOfRun + 1) * sizeof(IMG_Segment_t);
+                g_usedBytes      += pEntry->imageSize;
+                reVal = CACHE_GET_LOADED;
+            } else {
+                free(pEntry->image);
+                pEntry->image = NULL;
+                reVal = CACHE_GET_FAILED;
+            }
+        }
+    }
+
+    return reVal;
+}
+
+CacheImage_t CI_Init(const uint32_t maxBytes)
+{
+    CacheImage_t reVal = CACHE_INIT_FAILED;
+
+    if (maxBytes > 0)
+    {
+        CI_DeInit();
+        g_maxBytes = maxBytes;
+        reVal = CACHE_INIT_SUCCESSFUL;
+    } else {
+        reVal = CACHE_INIT_FAILED;
+    }
+
+    return reVal;
+}
+
+void CI_DeInit(void)
+{
+    uint32_t index = 0;
+
+    for (index = 0; index < CACHE_MAX_ENTRY; ++index)
+    {
+        CI_Release(&g_cacheEntry[index]);
+    }
+    g_usedBytes = 0;
+    g_tick      = 0;
+}
+
+CacheImage_t CI_Get(const char* fileName, ParseLine_t* checkFile, const uint8_t** image, const IMG_Map_t** map)
+{
+    CacheImage_t reVal  = CACHE_GET_FAILED;
+    char         path[PATH_MAX];
+    struct stat  status;
+    CI_Entry_t*  pEntry = NULL;
+    uint32_t     index  = 0;
+
+    if ((fileName != NULL) && (checkFile != NULL) && (image != NULL) && (map != NULL) && (realpath(fileName, path) != NULL) &&
+        (strlen(path) < CACHE_MAX_PATH) && (stat(path, &status) == 0))
+    {
+        for (index = 0; (index < CACHE_MAX_ENTRY) && (pEntry == NULL); ++index)
+        {
+            if (strcmp(g_cacheEntry[index].path, path) == 0)
+            {
+                pEntry = &g_cacheEntry[index];
+            } else {
+
+            }
+        }
+
+        if ((pEntry != NULL) && (pEntry->mtimeSec == status.st_mtim.tv_sec) && (pEntry->mtimeNsec == status.st_mtim.tv_nsec) &&
+            (pEntry->size == status.st_size) && (pEntry->inode == status.st_ino))
+        {
+            reVal = ((pEntry->checkFile == CHECK_FILE_SUCCESSFUL) && (pEntry->image == NULL)) ? CACHE_GET_TOO_LARGE : CACHE_GET_HIT;
+        } else {
+            /* New or changed file: reuse its slot, a free one or the least recently used one */
+            if (pEntry != NULL)
+            {
+                CI_Release(pEntry);
+            } else {
+                for (index = 0; (index < CACHE_MAX_ENTRY) && (pEntry == NULL); ++index)
+                {
+                    if (g_cacheEntry[index].path[0] == '\0')
+                    {
+                        pEntry = &g_cacheEntry[index];
+                    } else {
+
+                    }
+                }
+                if (pEntry == NULL)
+                {
+                    pEntry = CI_Evict_LRU(NULL, false);
+                } else {
+
+                }
+            }
+
+            strcpy(pEntry->path, path);
+            pEntry->mtimeSec  = status.st_mtim.tv_sec;
+            pEntry->mtimeNsec = status.st_mtim.tv_nsec;
+            pEntry->size      = status.st_size;
+            pEntry->inode     = status.st_ino;
+            reVal = CI_Load(pEntry);
+            if (reVal == CACHE_GET_FAILED)
+            {
+                CI_Release(pEntry);
+            } else {
+
+            }
+        }
+
+        if (reVal != CACHE_GET_FAILED)
+        {
+            pEntry->lastUse = ++g_tick;
+            *checkFile = pEntry->checkFile;
+            *image     = pEntry->image;
+            *map       = (pEntry->image != NULL) ? &pEntry->map : NULL;
+        } else {
+
+        }
+    } else {
+        reVal = CACHE_GET_FAILED;
+    }
+
+    return reVal;
+}
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,475 @@
+/*
+ * ImageFile.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ImageFile.h"
+#include <stdlib.h>
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+#define IMG_CRC_POLY       0xEDB88320U
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint64_t       g_numOfSegment = 0;     /* 64 bits so a huge file can't wrap the layout */
+static uint64_t       g_dataSize     = 0;
+static uint32_t       g_segmentEnd   = 0;     /* Address following the last byte added */
+static IMG_Segment_t* g_segment      = NULL;  /* Segment table being filled, NULL while measuring */
+static uint8_t*       g_data         = NULL;  /* Data area being filled */
+static uint32_t       g_dataOffset   = 0;     /* Offset of the data area in the image */
+static uint32_t       g_maxSegment   = 0;     /* Capacity from the layout */
+static uint32_t       g_maxData      = 0;
+static uint8_t        g_overflow     = false;
+static uint32_t       g_crcTable[256];
+static uint8_t        g_crcReady     = false;
+static const IMG_Segment_t* g_crcSegment = NULL; /* Segment table sorted by IMG_Compare_Segment */
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+
+/*
+ * @name: IMG_Hex_To_Byte
+ * ----------------------------
+ * @brief: Converts two hexadecimal characters to a byte
+ * @param[out] Str: Pointer to the two characters (already validated by PF_Check_File)
+ * @reVal: The byte value
+ */
+static uint8_t IMG_Hex_To_Byte(const uint8_t* Str)
+{
+    uint8_t high = (Str[0] >= 'A') ? (Str[0] - 'A' + 10) : (Str[0] - '0');
+    uint8_t low  = (Str[1] >= 'A') ? (Str[1] - 'A' + 10) : (Str[1] - '0');
+
+    return (uint8_t)((high << 4) | low);
+}
+
+/*
+ * @name: IMG_Add_Record
+ * ----------------------------
+ * @brief: Callback of PF_Export_Data: appends a data record to the current segment, or
+ *         opens a new one if its address does not follow the previous record
+ * @param[out] ABS_Address: The absolute address of the record
+ * @param[out] dataField: Pointer to the data field of the record
+ * @reVal: None
+ */
+static void IMG_Add_Record(uint32_t ABS_Address, uint8_t* dataField)
+{
+    uint32_t length = strlen((const char*)dataField) / 2;
+    uint32_t index  = 0;
+
+    if ((g_numOfSegment == 0) || (ABS_Address != g_segmentEnd))
+    {
+        if (g_segment != NULL)
+        {
+            if (g_numOfSegment < g_maxSegment)
+            {
+                g_segment[g_numOfSegment].address    = ABS_Address;
+                g_segment[g_numOfSegment].length     = 0;
+                g_segment[g_numOfSegment].dataOffset = g_dataOffset + (uint32_t)g_dataSize;
+            } else {
+                g_overflow = true;
+            }
+        } else {
+
+        }
+        g_numOfSegment++;
+    } else {
+
+    }
+
+    if ((g_segment != NULL) && (g_overflow == false))
+    {
+        if (g_dataSize + length <= g_maxData)
+        {
+            for (index = 0; index < length; ++index)
+            {
+                g_data[g_dataSize + index] = IMG_Hex_To_Byte(&dataField[index * 2]);
+            }
+            g_segment[g_numOfSegment - 1].length += length;
+        } else {
+            g_overflow = true;
+        }
+    } else {
+
+    }
+
+    g_dataSize  += length;
+    g_segmentEnd = ABS_Address + length;
+}
+
+ImageFile_t IMG_Measure(const char* fileName, IMG_Header_t* header)
+{
+    ImageFile_t reVal     = IMAGE_BUILD_FAILED;
+    uint64_t    totalSize = 0;
+
+    if ((fileName != NULL) && (header != NULL))
+    {
+        g_numOfSegment = 0;
+        g_dataSize     = 0;
+        g_segment      = NULL;
+        PF_Export_Data(fileName, IMG_Add_Record);
+
+        /* The header holds 32-bit sizes, a larger image can't be described */
+        totalSize = sizeof(IMG_Header_t) + g_numOfSegment * sizeof(IMG_Segment_t) + g_dataSize;
+        if (totalSize <= UINT32_MAX)
+        {
+            header->magic        = IMG_MAGIC;
+            header->version      = IMG_VERSION;
+            header->generation   = 0;
+            header->numOfSegment = (uint32_t)g_numOfSegment;
+            header->dataSize     = (uint32_t)g_dataSize;
+            header->totalSize    = (uint32_t)totalSize;
+            reVal = IMAGE_BUILD_SUCCESSFUL;
+        } else {
+            reVal = IMAGE_BUILD_FAILED;
+        }
+    } else {
+        reVal = IMAGE_BUILD_FAILED;
+    }
+
+    return reVal;
+}
+
+ImageFile_t IMG_Build(const char* fileName, uint8_t* image, const IMG_Header_t* header)
+{
+    ImageFile_t   reVal   = IMAGE_BUILD_FAILED;
+    IMG_Header_t* pHeader = (IMG_Header_t*)image;
+
+    if ((fileName != NULL) && (image != NULL) && (header != NULL))
+    {
+        g_numOfSegment = 0;
+        g_dataSize     = 0;
+        g_overflow     = false;
+        g_maxSegment   = header->numOfSegment;
+        g_maxData      = header->dataSize;
+        g_segment      = (IMG_Segment_t*)(image + sizeof(IMG_Header_t));
+        g_dataOffset   = sizeof(IMG_Header_t) + header->numOfSegment * sizeof(IMG_Segment_t);
+        g_data         = image + g_dataOffset;
+        PF_Export_Data(fileName, IMG_Add_Record);
+        g_segment      = NULL;
+        g_data         = NULL;
+
+        if ((g_overflow == false) && (g_numOfSegment == header->numOfSegment) && (g_dataSize == header->dataSize))
+        {
+            pHeader->magic        = header->magic;
+            pHeader->version      = header->version;
+            pHeader->numOfSegment = header->numOfSegment;
+            pHeader->dataSize     = header->dataSize;
+            pHeader->totalSize    = header->totalSize;
+            reVal = IMAGE_BUILD_SUCCESSFUL;
+        } else {
+            reVal = IMAGE_BUILD_FAILED;
+        }
+    } else {
+        reVal = IMAGE_BUILD_FAILED;
+    }
+
+    return reVal;
+}
+
+ImageFile_t IMG_Read(const uint8_t* image, const uint32_t address, const uint32_t length, uint8_t* Buff)
+{
+    ImageFile_t          reVal    = IMAGE_READ_FAILED;
+    const IMG_Header_t*  pHeader  = (const IMG_Header_t*)image;
+    const IMG_Segment_t* pSegment = NULL;
+    uint64_t             first    = 0;
+    uint64_t             last     = 0;
+    uint32_t             index    = 0;
+
+    if ((image != NULL) && (Buff != NULL) && ((uint64_t)address + length <= (uint64_t)UINT32_MAX + 1))
+    {
+        memset(Buff, IMG_ERASED_BYTE, length);
+        pSegment = (const IMG_Segment_t*)(image + sizeof(IMG_Header_t));
+        for (index = 0; index < pHeader->numOfSegment; ++index)
+        {
+            /* Copy the overlap of [address, address + length) and the segment */
+            first = (pSegment[index].address > address) ? pSegment[index].address : address;
+            last  = (uint64_t)pSegment[index].address + pSegment[index].length;
+            if ((uint64_t)address + length < last)
+            {
+                last = (uint64_t)address + length;
+            } else {
+
+            }
+            if (first < last)
+            {
+                memcpy(&Buff[first - address], image + pSegment[index].dataOffset + (first - pSegment[index].address), last - first);
+            } else {
+
+            }
+        }
+        reVal = IMAGE_READ_SUCCESSFUL;
+    } else {
+        reVal = IMAGE_READ_FAILED;
+    }
+
+    return reVal;
+}
+
+/*
+ * @name: IMG_Compare_Segment
+ * ----------------------------
+ * @brief: qsort callback: orders indexes of g_crcSegment by address, then by file order
+ * @param[out] first: Pointer to the first index
+ * @param[out] second: Pointer to the second index
+ * @reVal: Negative, 0 or positive as for qsort
+ */
+static int IMG_Compare_Segment(const void* first, const void* second)
+{
+    uint32_t indexA = *(const uint32_t*)first;
+    uint32_t indexB = *(const uint32_t*)second;
+    int      reVal  = 0;
+
+    if (g_crcSegment[indexA].address != g_crcSegment[indexB].address)
+    {
+        reVal = (g_crcSegment[indexA].address < g_crcSegment[indexB].address) ? -1 : 1;
+    } else {
+        reVal = (indexA < indexB) ? -1 : ((indexA > indexB) ? 1 : 0);
+    }
+
+    return reVal;
+}
+
+/*
+ * @name: IMG_Update_CRC
+ * ----------------------------
+ * @brief: Runs a CRC-32 over some bytes, or over a run of IMG_ERASED_BYTE if Buff is NULL
+ * @param[out] value: The CRC so far, not yet inverted
+ * @param[out] Buff: Pointer to the bytes, or NULL
+ * @param[out] length: Number of bytes
+ * @reVal: The updated CRC, not yet inverted
+ */
+static uint32_t IMG_Update_CRC(uint32_t value, const uint8_t* Buff, const uint64_t length)
+{
+    uint64_t index = 0;
+
+    if (Buff != NULL)
+    {
+        for (index = 0; index < length; ++index)
+        {
+            value = (value >> 8) ^ g_crcTable[(value ^ Buff[index]) & 0xFFU];
+        }
+    } else {
+        for (index = 0; index < length; ++index)
+        {
+            value = (value >> 8) ^ g_crcTable[(value ^ IMG_ERASED_BYTE) & 0xFFU];
+        }
+    }
+
+    return value;
+}
+
+ImageFile_t IMG_Map_Init(const uint8_t* image, IMG_Map_t* map)
+{
+    ImageFile_t          reVal       = IMAGE_BUILD_FAILED;
+    const IMG_Header_t*  pHeader     = (const IMG_Header_t*)image;
+    const IMG_Segment_t* pSegment    = NULL;
+    IMG_Segment_t*       pRun        = NULL;
+    uint32_t*            order       = NULL;  /* Segment indexes by address */
+    uint32_t*            active      = NULL;  /* Segments holding the current address */
+    uint32_t             numOfActive = 0;
+    uint32_t             numOfLeft   = 0;
+    uint32_t             next        = 0;     /* First entry of order not reached yet */
+    uint32_t             winner      = 0;
+    uint32_t             index       = 0;
+    uint64_t             current     = 0;
+    uint64_t             stop        = 0;
+    uint64_t             boundary    = 0;
+    uint64_t             segmentEnd  = 0;
+
+    if (map != NULL)
+    {
+        map->run      = NULL;
+        map->numOfRun = 0;
+    } else {
+
+    }
+
+    if ((image != NULL) && (map != NULL))
+    {
+        pSegment = (const IMG_Segment_t*)(image + sizeof(IMG_Header_t));
+        order    = malloc((pHeader->numOfSegment + 1) * sizeof(uint32_t));
+        active   = malloc((pHeader->numOfSegment + 1) * sizeof(uint32_t));
+        /* Runs only start or end at a segment end, so there are fewer than 2 per segment */
+        map->run = malloc((2 * (uint64_t)pHeader->numOfSegment + 1) * sizeof(IMG_Segment_t));
+    } else {
+
+    }
+
+    if ((order != NULL) && (active != NULL) && (map->run != NULL))
+    {
+        for (index = 0; index < pHeader->numOfSegment; ++index)
+        {
+            order[index] = index;
+            segmentEnd   = (uint64_t)pSegment[index].address + pSegment[index].length;
+            stop         = (segmentEnd > stop) ? segmentEnd : stop;
+        }
+        g_crcSegment = pSegment;
+        qsort(order, pHeader->numOfSegment, sizeof(uint32_t), IMG_Compare_Segment);
+        current = (pHeader->numOfSegment > 0) ? pSegment[order[0]].address : 0;
+
+        /* Sweep the address space one run at a time: between two boundaries the same segments
+           hold every address, so the run is either a gap or a slice of one segment */
+        while (current < stop)
+        {
+            while ((next < pHeader->numOfSegment) && (pSegment[order[next]].address <= current))
+            {
+                if ((uint64_t)pSegment[order[next]].address + pSegment[order[next]].length > current)
+                {
+                    active[numOfActive++] = order[next];
+                } else {
+
+                }
+                next++;
+            }
+
+            boundary = stop;
+            if ((next < pHeader->numOfSegment) && (pSegment[order[next]].address < boundary))
+            {
+                boundary = pSegment[order[next]].address;
+            } else {
+
+            }
+            numOfLeft   = numOfActive;
+            numOfActive = 0;
+            for (index = 0; index < numOfLeft; ++index)
+            {
+                segmentEnd = (uint64_t)pSegment[active[index]].address + pSegment[active[index]].length;
+                if (segmentEnd > current)
+                {
+                    /* Where records overlap, the last one in file order wins */
+                    if ((numOfActive == 0) || (active[index] > winner))
+                    {
+                        winner = active[index];
+                    } else {
+
+                    }
+                    if (segmentEnd < boundary)
+                    {
+                        boundary = segmentEnd;
+                    } else {
+
+                    }
+                    active[numOfActive++] = active[index];
+                } else {
+
+                }
+            }
+
+            if (numOfActive > 0)
+            {
+                pRun = &map->run[map->numOfRun++];
+                pRun->address    = (uint32_t)current;
+                pRun->length     = (uint32_t)(boundary - current);
+                pRun->dataOffset = pSegment[winner].dataOffset + (uint32_t)(current - pSegment[winner].address);
+            } else {
+
+            }
+            current = boundary;
+        }
+
+        /* Give back the slots that were not needed */
+        pRun = realloc(map->run, (map->numOfRun + 1) * sizeof(IMG_Segment_t));
+        map->run = (pRun != NULL) ? pRun : map->run;
+        reVal = IMAGE_BUILD_SUCCESSFUL;
+    } else if (map != NULL) {
+        free(map->run);
+        map->run = NULL;
+        reVal = IMAGE_BUILD_FAILED;
+    } else {
+        reVal = IMAGE_BUILD_FAILED;
+    }
+    free(order);
+    free(active);
+
+    return reVal;
+}
+
+void IMG_Map_DeInit(IMG_Map_t* map)
+{
+    if (map != NULL)
+    {
+        free(map->run);
+        map->run      = NULL;
+        map->numOfRun = 0;
+    } else {
+
+    }
+}
+
+ImageFile_t IMG_Get_CRC32(const uint8_t* image, const IMG_Map_t* map, const uint32_t address, const uint32_t length, uint32_t* crc)
+{
+    ImageFile_t          reVal    = IMAGE_READ_FAILED;
+    const IMG_Segment_t* pRun     = NULL;
+    uint32_t             value    = 0xFFFFFFFFU;
+    uint32_t             index    = 0;
+    uint32_t             low      = 0;
+    uint32_t             high     = 0;
+    uint32_t             bit      = 0;
+    uint64_t             current  = address;
+    uint64_t             stop     = (uint64_t)address + length;
+    uint64_t             runEnd   = 0;
+
+    if (g_crcReady == false)
+    {
+        for (index = 0; index < 256; ++index)
+        {
+            g_crcTable[index] = index;
+            for (bit = 0; bit < 8; ++bit)
+            {
+                g_crcTable[index] = (g_crcTable[index] & 1U) ? ((g_crcTable[index] >> 1) ^ IMG_CRC_POLY) : (g_crcTable[index] >> 1);
+            }
+        }
+        g_crcReady = true;
+    } else {
+
+    }
+
+    if ((image != NULL) && (map != NULL) && (crc != NULL) && (stop <= (uint64_t)UINT32_MAX + 1))
+    {
+        /* First run ending after address */
+        high = map->numOfRun;
+        while (low < high)
+        {
+            index = low + (high - low) / 2;
+            if ((uint64_t)map->run[index].address + map->run[index].length <= address)
+            {
+                low = index + 1;
+            } else {
+                high = index;
+            }
+        }
+
+        /* Runs don't overlap, what lies between them is a gap */
+        for (index = low; (index < map->numOfRun) && (map->run[index].address < stop); ++index)
+        {
+            pRun = &map->run[index];
+            if (pRun->address > current)
+            {
+                value   = IMG_Update_CRC(value, NULL, pRun->address - current);
+                current = pRun->address;
+            } else {
+
+            }
+            runEnd = (uint64_t)pRun->address + pRun->length;
+            runEnd = (runEnd < stop) ? runEnd : stop;
+            value   = IMG_Update_CRC(value, image + pRun->dataOffset + (current - pRun->address), runEnd - current);
+            current = runEnd;
+        }
+        value = IMG_Update_CRC(value, NULL, stop - current);
+        *crc  = value ^ 0xFFFFFFFFU;
+        reVal = IMAGE_READ_SUCCESSFUL;
+    } else {
+        reVal = IMAGE_READ_FAILED;
+    }
+
+    return reVal;
+}
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
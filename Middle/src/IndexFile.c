@@ -0,0 +1,236 @@
+/*
+ * IndexFile.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "IndexFile.h"
+#include <stdlib.h>
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const char* g_indexFile     = NULL;
+static IF_Entry_t* g_entry         = NULL;
+static uint32_t    g_numOfEntry    = 0;
+static uint32_t    g_maxEntry      = 0;
+static PF_Cursor_t g_nextCursor;            /* Where the next entry starts */
+static uint8_t     g_indexDone     = false;
+static uint32_t    g_minAddress    = 0;     /* Range of the entry being built */
+static uint32_t    g_maxAddress    = 0;
+static uint32_t    g_findAddress   = 0;     /* Address searched by IF_Find_Address */
+static uint32_t    g_foundID       = 0;
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+
+/*
+ * @name: IF_Track_Range
+ * ----------------------------
+ * @brief: Callback of PF_Read_Window: widens the address range of the entry being built
+ * @param[out] ID: The ID of the data record
+ * @param[out] ABS_Address: The absolute address of the data record
+ * @param[out] dataField: Pointer to the data field of the record
+ * @reVal: None
+ */
+static void IF_Track_Range(uint32_t ID, uint32_t ABS_Address, uint8_t* dataField)
+{
+    uint32_t lastAddress = ABS_Address + strlen((const char*)dataField) / 2 - 1;
+
+    (void)ID;
+    if (ABS_Address < g_minAddress)
+    {
+        g_minAddress = ABS_Address;
+    } else {
+
+    }
+    if (lastAddress > g_maxAddress)
+    {
+        g_maxAddress = lastAddress;
+    } else {
+
+    }
+}
+
+/*
+ * @name: IF_Match_Address
+ * ----------------------------
+ * @brief: Callback of PF_Read_Window: remembers the first record holding g_findAddress
+ * @param[out] ID: The ID of the data record
+ * @param[out] ABS_Address: The absolute address of the data record
+ * @param[out] dataField: Pointer to the data field of the record
+ * @reVal: None
+ */
+static void IF_Match_Address(uint32_t ID, uint32_t ABS_Address, uint8_t* dataField)
+{
+    if ((g_foundID == 0) && (g_findAddress >= ABS_Address) && (g_findAddress - ABS_Address < strlen((const char*)dataField) / 2))
+    {
+        g_foundID = ID;
+    } else {
+
+    }
+}
+
+IndexFile_t IF_Init(const char* fileName)
+{
+    IndexFile_t reVal = INDEX_INIT_FAILED;
+
+    if (fileName != NULL)
+    {
+        IF_DeInit();
+        g_indexFile              = fileName;
+        g_nextCursor.offset      = 0;
+        g_nextCursor.ID          = 1;
+        g_nextCursor.typeExtend  = DATA_RECORD;
+        g_nextCursor.valueExtend = 0;
+        g_indexDone              = false;
+        reVal = INDEX_INIT_SUCCESSFUL;
+    } else {
+        reVal = INDEX_INIT_FAILED;
+    }
+
+    return reVal;
+}
+
+void IF_DeInit(void)
+{
+    free(g_entry);
+    g_entry      = NULL;
+    g_numOfEntry = 0;
+    g_maxEntry   = 0;
+    g_indexFile  = NULL;
+    g_indexDone  = true;
+}
+
+IndexFile_t IF_Build_Step(void)
+{
+    IndexFile_t reVal  = INDEX_BUILD_DONE;
+    ParseLine_t status = CHECK_FILE_FAILED;
+    PF_Cursor_t start  = g_nextCursor;
+    IF_Entry_t* pEntry = NULL;
+
+    if (g_indexDone == false)
+    {
+        /* Grow the table by doubling */
+        if (g_numOfEntry == g_maxEntry)
+        {
+            pEntry = realloc(g_entry, ((g_maxEntry == 0) ? 64 : (g_maxEntry * 2)) * sizeof(IF_Entry_t));
+            if (pEntry != NULL)
+            {
+                g_entry    = pEntry;
+                g_maxEntry = (g_maxEntry == 0) ? 64 : (g_maxEntry * 2);
+            } else {
+                g_indexDone = true;
+            }
+        } else {
+
+        }
+
+        if (g_indexDone == false)
+        {
+            g_minAddress = UINT32_MAX;
+            g_maxAddress = 0;
+            status = PF_Read_Window(g_indexFile, &g_nextCursor, INDEX_STRIDE, IF_Track_Range);
+            if (g_nextCursor.ID > start.ID)
+            {
+                g_entry[g_numOfEntry].cursor     = start;
+                g_entry[g_numOfEntry].minAddress = g_minAddress;
+                g_entry[g_numOfEntry].maxAddress = g_maxAddress;
+                g_numOfEntry++;
+            } else {
+
+            }
+            g_indexDone = (status != CHECK_FILE_SUCCESSFUL);
+        } else {
+
+        }
+    } else {
+
+    }
+
+    reVal = (g_indexDone == true) ? INDEX_BUILD_DONE : INDEX_BUILD_IN_PROGRESS;
+
+    return reVal;
+}
+
+IndexFile_t IF_Find_ID(const uint32_t ID, PF_Cursor_t* cursor)
+{
+    IndexFile_t reVal = INDEX_FIND_FAILED;
+    uint32_t    entry = 0;
+
+    if ((cursor != NULL) && (ID > 0))
+    {
+        entry = (ID - 1) / INDEX_STRIDE;
+        while ((entry >= g_numOfEntry) && (IF_Build_Step() == INDEX_BUILD_IN_PROGRESS))
+        {
+
+        }
+
+        /* The record exists if it comes before the first record of the next entry */
+        if ((entry < g_numOfEntry) &&
+            (ID < ((entry + 1 < g_numOfEntry) ? g_entry[entry + 1].cursor.ID : g_nextCursor.ID)))
+        {
+            /* Walk from the entry to the record without decoding the ones before it */
+            *cursor = g_entry[entry].cursor;
+            PF_Read_Window(g_indexFile, cursor, ID - cursor->ID, NULL);
+            reVal = (cursor->ID == ID) ? INDEX_FIND_SUCCESSFUL : INDEX_FIND_FAILED;
+        } else {
+            reVal = INDEX_FIND_FAILED;
+        }
+    } else {
+        reVal = INDEX_FIND_FAILED;
+    }
+
+    return reVal;
+}
+
+IndexFile_t IF_Find_Address(const uint32_t address, PF_Cursor_t* cursor)
+{
+    IndexFile_t reVal  = INDEX_FIND_FAILED;
+    PF_Cursor_t walker;
+    uint32_t    entry  = 0;
+    uint8_t     Stop   = false;
+
+    if (cursor != NULL)
+    {
+        g_findAddress = address;
+        g_foundID     = 0;
+        while (Stop == false)
+        {
+            if (entry < g_numOfEntry)
+            {
+                /* Only read the runs that may hold the address */
+                if ((address >= g_entry[entry].minAddress) && (address <= g_entry[entry].maxAddress))
+                {
+                    walker = g_entry[entry].cursor;
+                    PF_Read_Window(g_indexFile, &walker, INDEX_STRIDE, IF_Match_Address);
+                    Stop = (g_foundID != 0);
+                } else {
+
+                }
+                entry++;
+            } else if (IF_Build_Step() == INDEX_BUILD_DONE) {
+                Stop = (entry >= g_numOfEntry);
+            } else {
+
+            }
+        }
+
+        if (g_foundID != 0)
+        {
+            reVal = IF_Find_ID(g_foundID, cursor);
+        } else {
+            reVal = INDEX_FIND_FAILED;
+        }
+    } else {
+        reVal = INDEX_FIND_FAILED;
+    }
+
+    return reVal;
+}
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
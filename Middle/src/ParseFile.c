@@ -9,12 +9,44 @@
  * Includes
  ******************************************************************************/
 #include "ParseFile.h"
+#include "WatchFile.h"
+#include <stdlib.h>
+/*******************************************************************************
+ * Typedef structs & enums
+ ******************************************************************************/
+
+/*
+ * @name: WatchBlock_t
+ * ----------------------------
+ * @brief: State kept by the watch mode for every WATCH_BLOCK_SIZE bytes of the file.
+ *         The checkpoint is the first record starting in or after the block together
+ *         with the extended address state in force before that record.
+ */
+typedef struct {
+    uint32_t hash;          /* FNV-1a hash of the block content at the last pass */
+    int64_t  cpOffset;      /* Byte offset of the checkpoint record */
+    uint32_t cpID;          /* ID of the first data record from the checkpoint on */
+    uint32_t cpValue;       /* g_valueExtend before the checkpoint record */
+    uint8_t  cpType;        /* g_typeExtend before the checkpoint record */
+    uint8_t  cpValid;       /* The checkpoint record was validated */
+    uint8_t  changed;       /* Scratch: block content differs from the last pass */
+} WatchBlock_t;
 /*******************************************************************************
  * Variables
  ******************************************************************************/
-static uint8_t  g_typeExtend  = 0;
-static uint32_t g_valueExtend = 0;
-static uint8_t  g_recordEOF   = false;
+static uint8_t       g_typeExtend  = 0;
+static uint32_t      g_valueExtend = 0;
+static uint8_t       g_recordEOF   = false;
+static WatchBlock_t* g_watchBlock  = NULL;  /* One entry per block of the watched file */
+static uint32_t      g_numOfBlock  = 0;
+static uint32_t      g_maxBlock    = 0;     /* Capacity of g_watchBlock */
+static int64_t       g_watchSize   = 0;     /* File size hashed at the last pass */
+static int64_t       g_lastOffset  = 0;     /* End of the last validated record */
+static uint8_t       g_lastType    = 0;     /* g_typeExtend at g_lastOffset */
+static uint32_t      g_lastValue   = 0;     /* g_valueExtend at g_lastOffset */
+static uint32_t      g_lastID      = 1;     /* ID of the first data record after g_lastOffset */
+static ParseLine_t   g_errorKind   = CHECK_FILE_SUCCESSFUL; /* Failure reported at the last pass */
+static int64_t       g_errorOffset = 0;     /* Byte offset of the failure reported at the last pass */
 /*******************************************************************************
  * Function Prototypes
  ******************************************************************************/
@@ -121,6 +153,31 @@ static ParseLine_t PF_Check_SYNTAX(const uint8_t* const Line)
     return reVal;
 }
 
+/*
+ * @name: PF_Cal_SUM
+ * ----------------------------
+ * @brief: Computes the checksum a line should have and reads the one it has
+ * @param[out] Line: Pointer to the line, already checked by PF_Check_SYNTAX
+ * @param[in] expected: Pointer to the variable where the computed checksum will be stored
+ * @param[in] found: Pointer to the variable where the checksum field will be stored
+ * @reVal: None
+ */
+static void PF_Cal_SUM(const uint8_t* const Line, uint8_t* expected, uint8_t* found)
+{
+    uint8_t     Sum      = 0;
+    uint16_t    index    = 0;
+    uint16_t    length   = 0;
+
+    length = strlen(Line);
+    for (index = 0; index < (length - 5) / 2; ++index)
+    {
+        Sum += convertStrToDec(&Line[index * 2 + 1], 2);
+    }
+
+    *expected = ~Sum + 0x01;
+    *found    = convertStrToDec(&Line[length - 4], 2);
+}
+
 /*
  * @name: PF_Check_SUM
  * ----------------------------
@@ -134,19 +191,10 @@ static ParseLine_t PF_Check_SUM(const uint8_t* const Line)
     ParseLine_t reVal    = CHECK_SUM_FAILED;
     uint8_t     checkSum = 0;
     uint8_t     Sum      = 0;
-    uint8_t     index    = 0;
-    uint16_t    length   = 0;
     
     if (Line != NULL)
     {
-        length = strlen(Line);
-        for (index = 0; index < (length - 5) / 2; ++index)
-        {
-            Sum += convertStrToDec(&Line[index * 2 + 1], 2);
-        }
-
-        Sum = ~Sum + 0x01;
-        checkSum = convertStrToDec(&Line[length - 4], 2);
+        PF_Cal_SUM(Line, &Sum, &checkSum);
 
         if (Sum == checkSum)
         {
@@ -264,7 +312,15 @@ static uint32_t PF_Cal_ABS_Address(const uint32_t addressField)
     return ABS_Address;
 }
 
-ParseLine_t PF_Check_File(const char* fileName)
+/*
+ * @name: PF_Check_Line
+ * ----------------------------
+ * @brief: Runs every record check on a single line, in the same order as PF_Check_File
+ * @param[out] Line: Pointer to the line to be checked
+ * @reVal: - CHECK_FILE_SUCCESSFUL if the line passed all checks
+           - The ParseLine_t value of the first check that failed
+ */
+static ParseLine_t PF_Check_Line(const uint8_t* const Line)
 {
     ParseLine_t reVal       = CHECK_FILE_SUCCESSFUL;
     ParseLine_t checkStart  = CHECK_START_FAILED;
@@ -272,6 +328,428 @@ ParseLine_t PF_Check_File(const char* fileName)
     ParseLine_t checkSum    = CHECK_SUM_FAILED;
     ParseLine_t checkType   = CHECK_RECORD_TYPE_FAILED;
     ParseLine_t checkCount  = CHECK_BYTE_COUNT_FAILED;
+
+    checkStart = PF_Check_RC_Start(Line); /* Check start field */
+    if (checkStart == CHECK_START_SUCCESSFUL)
+    {
+        checkSyntax = PF_Check_SYNTAX(Line); /* Check systax */
+        if (checkSyntax == CHECK_SYNTAX_ASCII_SUCCESSFUL)
+        {
+            checkSum = PF_Check_SUM(Line); /* Check Checksum */
+            if (checkSum == CHECK_SUM_SUCCESSFUL)
+            {
+                checkType = PF_Check_Record_Type(Line); /* Check type field */
+                if (checkType == CHECK_RECORD_TYPE_SUCCESSFUL)
+                {
+                    checkCount = PF_Check_Byte_Count(Line); /* Check byte count */
+                    if (checkCount == CHECK_BYTE_COUNT_SUCCESSFUL)
+                    {
+                        reVal = CHECK_FILE_SUCCESSFUL;
+                    } else {
+                        reVal = CHECK_BYTE_COUNT_FAILED;
+                    }
+                } else {
+                    reVal = CHECK_RECORD_TYPE_FAILED;
+                }
+            } else {
+                reVal = CHECK_SUM_FAILED;
+            }
+        } else {
+            reVal = CHECK_SYNTAX_ASCII_FAILED;
+        }
+    } else {
+        reVal = CHECK_START_FAILED;
+    }
+
+    return reVal;
+}
+
+/*
+ * @name: PF_Handle_Record
+ * ----------------------------
+ * @brief: Decodes one validated line: updates the extended address state and passes
+ *         data records to the callback
+ * @param[out] Line: Pointer to the line to be decoded
+ * @param[in] Print_Address_Data: The callback for data records, NULL to only track the address state
+ * @reVal: None
+ */
+static void PF_Handle_Record(const uint8_t* const Line, func Print_Address_Data)
+{
+    uint32_t    ABS_Address  = 0;
+    uint32_t    addressField = 0;
+    uint8_t     DataField[MAX_DATA_FIELD];
+    uint16_t    length       = 0;
+    uint8_t     recordType   = 0;
+    uint8_t     byteCount    = 0;
+
+    recordType = convertStrToDec(&Line[START_TYPE_FIELD], 2);
+    length = strlen(Line);
+
+    switch (recordType)
+    {
+        case DATA_RECORD:
+            if (Print_Address_Data != NULL)
+            {
+                addressField = convertStrToDec(&Line[START_ADD_FIELD], 4);
+                ABS_Address  = PF_Cal_ABS_Address(addressField);
+                memset(DataField, 0, MAX_DATA_FIELD);
+                memcpy(DataField, &Line[START_DATA_FIELD], length - 13);
+                Print_Address_Data(ABS_Address, DataField); /* Callback here */
+            } else {
+
+            }
+            break;
+        case EXTENDED_SEGMENT:
+            g_typeExtend  = EXTENDED_SEGMENT;
+            byteCount   = convertStrToDec(&Line[START_BYTE_COUNT_FIELD], 2);
+            g_valueExtend = convertStrToDec(&Line[START_DATA_FIELD], byteCount * 2);
+            break;
+        case EXTENDED_LINEAR:
+            g_typeExtend  = EXTENDED_LINEAR;
+            byteCount   = convertStrToDec(&Line[START_BYTE_COUNT_FIELD], 2);
+            g_valueExtend = convertStrToDec(&Line[START_DATA_FIELD], byteCount * 2);
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+ * @name: PF_View_Record
+ * ----------------------------
+ * @brief: Decodes one validated data record and passes it to the callback with its ID
+ * @param[out] Line: Pointer to the data record
+ * @param[out] ID: The ID of the data record
+ * @param[in] Print_Record: The callback
+ * @reVal: None
+ */
+static void PF_View_Record(const uint8_t* const Line, const uint32_t ID, viewFunc Print_Record)
+{
+    uint32_t    ABS_Address  = 0;
+    uint32_t    addressField = 0;
+    uint8_t     DataField[MAX_DATA_FIELD];
+    uint16_t    length       = 0;
+
+    length       = strlen((const char*)Line);
+    addressField = convertStrToDec(&Line[START_ADD_FIELD], 4);
+    ABS_Address  = PF_Cal_ABS_Address(addressField);
+    memset(DataField, 0, MAX_DATA_FIELD);
+    memcpy(DataField, &Line[START_DATA_FIELD], length - 13);
+    Print_Record(ID, ABS_Address, DataField); /* Callback here */
+}
+
+/*
+ * @name: PF_Hash_Block
+ * ----------------------------
+ * @brief: Computes the 32-bit FNV-1a hash of a buffer
+ * @param[out] Buff: Pointer to the bytes to be hashed
+ * @param[out] size: Number of bytes to be hashed
+ * @reVal: The hash value
+ */
+static uint32_t PF_Hash_Block(const uint8_t* Buff, const uint32_t size)
+{
+    uint32_t hash  = 2166136261U;
+    uint32_t index = 0;
+
+    for (index = 0; index < size; ++index)
+    {
+        hash = (hash ^ Buff[index]) * 16777619U;
+    }
+
+    return hash;
+}
+
+/*
+ * @name: PF_Watch_Hash
+ * ----------------------------
+ * @brief: Hashes the opened file block by block and flags the blocks whose content
+ *         differs from the last pass. Only the bytes that existed at the last pass are
+ *         compared, so data appended to the last block does not flag it.
+ * @param[in] newSize: Pointer to the variable where the number of bytes hashed will be stored
+ * @reVal: - CHECK_FILE_SUCCESSFUL if the block table was updated
+           - CHECK_FILE_FAILED if the block table can't be allocated
+ * @Note: The checkpoints of the retained blocks are kept; new blocks start without one.
+ */
+static ParseLine_t PF_Watch_Hash(int64_t* newSize)
+{
+    ParseLine_t   reVal     = CHECK_FILE_SUCCESSFUL;
+    uint8_t       Buff[WATCH_BLOCK_SIZE];
+    uint32_t      readSize  = 0;
+    uint32_t      oldLength = 0;
+    uint32_t      index     = 0;
+    uint32_t      maxBlock  = 0;
+    WatchBlock_t* pBlock    = NULL;
+
+    *newSize = 0;
+
+    while ((reVal == CHECK_FILE_SUCCESSFUL) && (RF_Read_Block(Buff, WATCH_BLOCK_SIZE, &readSize) == READ_BLOCK_SUCCESSFUL))
+    {
+        if (index >= g_maxBlock)
+        {
+            /* Grow geometrically so a large file costs a few reallocations, not one per block */
+            maxBlock = (g_maxBlock == 0) ? 64 : (g_maxBlock * 2);
+            pBlock = realloc(g_watchBlock, maxBlock * sizeof(WatchBlock_t));
+            if (pBlock != NULL)
+            {
+                g_watchBlock = pBlock;
+                g_maxBlock   = maxBlock;
+            } else {
+                reVal = CHECK_FILE_FAILED;
+            }
+        } else {
+
+        }
+
+        if (reVal != CHECK_FILE_SUCCESSFUL)
+        {
+
+        } else if (index >= g_numOfBlock) {
+            memset(&g_watchBlock[index], 0, sizeof(WatchBlock_t));
+            g_watchBlock[index].changed = true;
+            g_numOfBlock = index + 1;
+        } else {
+            /* Compare against the bytes hashed at the last pass only */
+            oldLength = ((int64_t)(index + 1) * WATCH_BLOCK_SIZE <= g_watchSize) ? WATCH_BLOCK_SIZE : (uint32_t)(g_watchSize - (int64_t)index * WATCH_BLOCK_SIZE);
+            if (readSize < oldLength)
+            {
+                g_watchBlock[index].changed = true;
+            } else {
+                g_watchBlock[index].changed = (PF_Hash_Block(Buff, oldLength) != g_watchBlock[index].hash);
+            }
+        }
+
+        if (reVal == CHECK_FILE_SUCCESSFUL)
+        {
+            g_watchBlock[index].hash = PF_Hash_Block(Buff, readSize);
+            *newSize += readSize;
+            index++;
+        } else {
+
+        }
+    }
+
+    if (reVal == CHECK_FILE_SUCCESSFUL)
+    {
+        /* Drop the blocks cut off by a truncation, the cut block itself is re-validated */
+        if ((*newSize < g_watchSize) && (index > 0))
+        {
+            g_watchBlock[index - 1].changed = true;
+        } else {
+
+        }
+        g_numOfBlock = index;
+        if (*newSize < g_lastOffset)
+        {
+            g_lastOffset = *newSize;
+        } else {
+
+        }
+    } else {
+
+    }
+
+    return reVal;
+}
+
+/*
+ * @name: PF_Watch_Run
+ * ----------------------------
+ * @brief: Validates and decodes the opened file from a known record boundary and
+ *         extended address state, refreshing the block checkpoints on the way
+ * @param[out] startOffset: Byte offset of the first record to be parsed
+ * @param[out] typeExtend: Extended address type in force at startOffset
+ * @param[out] valueExtend: Extended address value in force at startOffset
+ * @param[out] startID: ID of the first data record from startOffset on
+ * @param[out] emitFrom: Records ending at or before this offset are only used to track the address state
+ * @param[out] newSize: Number of bytes hashed in this pass, later bytes are left for the next pass
+ * @param[in] Print_Record: The callback for data records
+ * @param[in] endOffset: Pointer to the variable where the offset the run stopped at will be stored
+ * @reVal: - CHECK_FILE_SUCCESSFUL if the run caught up with an unchanged checkpoint (resynchronized)
+ *         - CHECK_EOF_FAILED if the run reached the last complete record of the file
+ *         - Other ParseLine_t values if a record failed validation at endOffset
+ * @Note: Resynchronization is only attempted once the run has passed startOffset and emitFrom.
+ */
+static ParseLine_t PF_Watch_Run(const int64_t startOffset, const uint8_t typeExtend, const uint32_t valueExtend, const uint32_t startID,
+                                const int64_t emitFrom, const int64_t newSize, viewFunc Print_Record, int64_t* endOffset)
+{
+    ParseLine_t   reVal       = CHECK_EOF_FAILED;
+    ParseLine_t   checkLine   = CHECK_FILE_FAILED;
+    uint8_t       Line[MAX_CHAR_EACH_LINE];
+    int64_t       offset      = startOffset;
+    int64_t       nextOffset  = 0;
+    uint32_t      nextCp      = 0;
+    uint32_t      block       = 0;
+    uint32_t      ID          = startID;
+    uint16_t      length      = 0;
+    uint8_t       Stop        = false;
+    WatchBlock_t* pBlock      = NULL;
+
+    g_typeExtend  = typeExtend;
+    g_valueExtend = valueExtend;
+    nextCp = (uint32_t)((startOffset + WATCH_BLOCK_SIZE - 1) / WATCH_BLOCK_SIZE);
+    RF_Seek(startOffset);
+
+    while (Stop == false)
+    {
+        /* Stop at the first record of an unchanged block seen in the same state and with the
+           same ID as last pass: from there on, every record was already exported as it is */
+        block  = (uint32_t)(offset / WATCH_BLOCK_SIZE);
+        pBlock = (block < g_numOfBlock) ? &g_watchBlock[block] : NULL;
+        if ((offset > startOffset) && (offset >= emitFrom) && (pBlock != NULL) && (pBlock->changed == false) && (pBlock->cpValid == true) &&
+            (pBlock->cpOffset == offset) && (pBlock->cpType == g_typeExtend) && (pBlock->cpValue == g_valueExtend) && (pBlock->cpID == ID))
+        {
+            reVal = CHECK_FILE_SUCCESSFUL;
+            Stop  = true;
+        } else if (Read_Line(Line) == READ_LINE_FAILED) {
+            Stop = true;
+        } else {
+            RF_Tell(&nextOffset);
+            length = strlen((const char*)Line);
+            if ((length == MAX_CHAR_EACH_LINE - 1) && (Line[length - 1] != '\n'))
+            {
+                /* No record is that long, waiting for the rest of it would never end */
+                reVal = CHECK_BYTE_COUNT_FAILED;
+                Stop  = true;
+            } else if ((nextOffset > newSize) || (length == 0) || (Line[length - 1] != '\n')) {
+                /* A record still being written is left for the next pass */
+                Stop = true;
+            } else {
+                while ((nextCp < g_numOfBlock) && ((int64_t)nextCp * WATCH_BLOCK_SIZE <= offset))
+                {
+                    g_watchBlock[nextCp].cpOffset = offset;
+                    g_watchBlock[nextCp].cpType   = g_typeExtend;
+                    g_watchBlock[nextCp].cpValue  = g_valueExtend;
+                    g_watchBlock[nextCp].cpID     = ID;
+                    g_watchBlock[nextCp].cpValid  = true;
+                    nextCp++;
+                }
+
+                checkLine = PF_Check_Line(Line);
+                if (checkLine == CHECK_FILE_SUCCESSFUL)
+                {
+                    if (convertStrToDec(&Line[START_TYPE_FIELD], 2) == DATA_RECORD)
+                    {
+                        if (nextOffset > emitFrom)
+                        {
+                            PF_View_Record(Line, ID, Print_Record);
+                        } else {
+
+                        }
+                        ID++;
+                    } else {
+                        PF_Handle_Record(Line, NULL);
+                    }
+                    offset = nextOffset;
+                } else {
+                    reVal = checkLine;
+                    Stop  = true;
+                }
+            }
+        }
+    }
+
+    if (reVal != CHECK_FILE_SUCCESSFUL)
+    {
+        /* Everything past the stop point is unvalidated until a later pass reaches it */
+        for (; nextCp < g_numOfBlock; ++nextCp)
+        {
+            g_watchBlock[nextCp].cpValid = false;
+        }
+        g_lastOffset = offset;
+        g_lastType   = g_typeExtend;
+        g_lastValue  = g_valueExtend;
+        g_lastID     = ID;
+    } else {
+
+    }
+    *endOffset = offset;
+
+    return reVal;
+}
+
+/*
+ * @name: PF_Watch_Pass
+ * ----------------------------
+ * @brief: Brings the decoded view of the file up to date after a change.
+ *         Changed blocks inside the validated part are re-parsed from the checkpoint of
+ *         the block before them until the parse lines up with an unchanged checkpoint,
+ *         then appended data is parsed from the last validated record.
+ * @param[out] fileName: The name of the watched file
+ * @param[in] Print_Record: The callback for new or updated data records
+ * @param[in] Print_Error: The callback for the record that stopped the pass
+ * @reVal: None
+ * @note: A failure is reported once; it is reported again only after a pass went through
+ *        without it or if another failure takes its place.
+ */
+static void PF_Watch_Pass(const char* fileName, viewFunc Print_Record, errorFunc Print_Error)
+{
+    ParseLine_t   status    = CHECK_FILE_SUCCESSFUL;
+    int64_t       newSize   = 0;
+    int64_t       endOffset = 0;
+    uint32_t      index     = 0;
+    WatchBlock_t* pBlock    = NULL;
+
+    if (RF_Init(fileName) == FILE_INIT_SUCCESSFUL)
+    {
+        status = PF_Watch_Hash(&newSize);
+        if (status == CHECK_FILE_SUCCESSFUL)
+        {
+            /* Re-validate the changed blocks of the already validated part */
+            while ((status == CHECK_FILE_SUCCESSFUL) && (index < g_numOfBlock) && ((int64_t)index * WATCH_BLOCK_SIZE < g_lastOffset))
+            {
+                if (g_watchBlock[index].changed == true)
+                {
+                    if (index == 0)
+                    {
+                        status = PF_Watch_Run(0, DATA_RECORD, 0, 1, 0, newSize, Print_Record, &endOffset);
+                    } else if (g_watchBlock[index - 1].cpValid == true) {
+                        pBlock = &g_watchBlock[index - 1];
+                        status = PF_Watch_Run(pBlock->cpOffset, pBlock->cpType, pBlock->cpValue, pBlock->cpID, (int64_t)index * WATCH_BLOCK_SIZE,
+                                              newSize, Print_Record, &endOffset);
+                    } else {
+                        /* No record starts before this block: the append below covers it */
+                        endOffset = g_lastOffset;
+                    }
+                    index = (endOffset / WATCH_BLOCK_SIZE > index) ? (uint32_t)(endOffset / WATCH_BLOCK_SIZE) : (index + 1);
+                } else {
+                    index++;
+                }
+            }
+
+            /* Resume after the last validated record with the extended address state saved there */
+            if (status == CHECK_FILE_SUCCESSFUL)
+            {
+                status = PF_Watch_Run(g_lastOffset, g_lastType, g_lastValue, g_lastID, g_lastOffset, newSize, Print_Record, &endOffset);
+            } else {
+
+            }
+            g_watchSize = newSize;
+        } else {
+            endOffset = 0;
+        }
+        g_recordEOF = false;
+        RF_DeInit();
+    } else {
+        status    = CHECK_FILE_FAILED;
+        endOffset = 0;
+    }
+
+    if ((status == CHECK_FILE_SUCCESSFUL) || (status == CHECK_EOF_FAILED))
+    {
+        g_errorKind = CHECK_FILE_SUCCESSFUL;
+    } else if ((status != g_errorKind) || (endOffset != g_errorOffset)) {
+        g_errorKind   = status;
+        g_errorOffset = endOffset;
+        Print_Error(status, endOffset);
+    } else {
+
+    }
+}
+
+ParseLine_t PF_Check_File(const char* fileName)
+{
+    ParseLine_t reVal       = CHECK_FILE_SUCCESSFUL;
+    ParseLine_t checkLine   = CHECK_FILE_FAILED;
     ReadFile_t  openStatus  = FILE_INIT_FAILED;
     uint8_t     Line[MAX_CHAR_EACH_LINE];
     uint8_t     Error       = false;
@@ -285,48 +763,140 @@ ParseLine_t PF_Check_File(const char* fileName)
             /* Parse each line to find an error or end of file*/
             while((Read_Line(Line) != READ_LINE_FAILED) && (Error == false))
             {
-                checkStart = PF_Check_RC_Start(Line); /* Check start field */
-                if (checkStart == CHECK_START_SUCCESSFUL)
+                checkLine = PF_Check_Line(Line);
+                if (checkLine != CHECK_FILE_SUCCESSFUL)
+                {
+                    reVal = checkLine;
+                    Error = true;
+                } else {
+                    Error = false;
+                }
+            }
+
+            /* Check record end of file */
+            if (reVal == CHECK_FILE_SUCCESSFUL && g_recordEOF == false)
+            {
+                reVal = CHECK_EOF_FAILED;
+            } else {
+                g_recordEOF = false;
+            }
+
+            /* Close file */
+            RF_DeInit();
+        } else {
+            reVal = CHECK_FILE_FAILED;
+        }
+    } else {
+        reVal = CHECK_FILE_FAILED;
+    }
+
+    return reVal;
+}
+
+/*
+ * @name: PF_Add_Error
+ * ----------------------------
+ * @brief: Counts an error and stores it if the list has room
+ * @param[in] errorList: Pointer to the list
+ * @param[out] lineNumber: Line number of the failing record
+ * @param[out] offset: Byte offset of the failing record
+ * @param[out] kind: The check that failed
+ * @param[out] Line: Pointer to the failing line, NULL if there is none (missing EOF)
+ * @reVal: None
+ */
+static void PF_Add_Error(PF_Error_List_t* errorList, const uint32_t lineNumber, const int64_t offset,
+                         const ParseLine_t kind, const uint8_t* const Line)
+{
+    PF_Error_t* pError = NULL;
+
+    if (errorList->numOfEntry < MAX_ERROR_ENTRY)
+    {
+        pError = &errorList->entry[errorList->numOfEntry];
+        pError->line        = lineNumber;
+        pError->offset      = offset;
+        pError->kind        = kind;
+        pError->expectedSum = 0;
+        pError->foundSum    = 0;
+        if ((kind == CHECK_SUM_FAILED) && (Line != NULL))
+        {
+            PF_Cal_SUM(Line, &pError->expectedSum, &pError->foundSum);
+        } else {
+
+        }
+        errorList->numOfEntry++;
+    } else {
+
+    }
+    errorList->numOfError++;
+}
+
+ParseLine_t PF_Collect_Errors(const char* fileName, PF_Error_List_t* errorList)
+{
+    ParseLine_t reVal      = CHECK_FILE_SUCCESSFUL;
+    ParseLine_t checkLine  = CHECK_FILE_FAILED;
+    ReadFile_t  openStatus = FILE_INIT_FAILED;
+    uint8_t     Line[MAX_CHAR_EACH_LINE];
+    uint32_t    lineNumber = 0;
+    int64_t     offset     = 0;
+    uint16_t    length     = 0;
+    uint8_t     Continued  = false;   /* The previous read stopped inside an over-long line */
+
+    if ((fileName != NULL) && (errorList != NULL))
+    {
+        errorList->numOfEntry = 0;
+        errorList->numOfError = 0;
+
+        /* Open file */
+        openStatus = RF_Init(fileName);
+        if (openStatus == FILE_INIT_SUCCESSFUL)
+        {
+            /* Parse each line to the end of file, whatever fails */
+            while (Read_Line(Line) != READ_LINE_FAILED)
+            {
+                if (Continued == false)
                 {
-                    checkSyntax = PF_Check_SYNTAX(Line); /* Check systax */
-                    if (checkSyntax == CHECK_SYNTAX_ASCII_SUCCESSFUL)
+                    lineNumber++;
+                    checkLine = PF_Check_Line(Line);
+                    if (checkLine != CHECK_FILE_SUCCESSFUL)
                     {
-                        checkSum = PF_Check_SUM(Line); /* Check Checksum */
-                        if (checkSum == CHECK_SUM_SUCCESSFUL)
+                        /* The rest of an over-long line belongs to the same record, its
+                           checksum can't be worked out from a part of it */
+                        length    = strlen((const char*)Line);
+                        Continued = (length == MAX_CHAR_EACH_LINE - 1) && (Line[length - 1] != '\n');
+                        if (Continued == true)
                         {
-                            checkType = PF_Check_Record_Type(Line); /* Check type field */
-                            if (checkType == CHECK_RECORD_TYPE_SUCCESSFUL)
-                            {
-                                checkCount = PF_Check_Byte_Count(Line); /* Check byte count */
-                                if (checkCount == CHECK_BYTE_COUNT_SUCCESSFUL)
-                                {
-                                    Error = false;
-                                } else {
-                                    reVal = CHECK_BYTE_COUNT_FAILED;
-                                    Error = true;
-                                }
-                            } else {
-                                reVal = CHECK_RECORD_TYPE_FAILED;
-                                Error = true;
-                            }
+                            checkLine = CHECK_BYTE_COUNT_FAILED;
                         } else {
-                            reVal = CHECK_SUM_FAILED;
-                            Error = true;
+
                         }
+                        if (reVal == CHECK_FILE_SUCCESSFUL)
+                        {
+                            reVal = checkLine;
+                        } else {
+
+                        }
+                        RF_Tell(&offset);
+                        PF_Add_Error(errorList, lineNumber, offset - length, checkLine, Line);
                     } else {
-                        reVal = CHECK_SYNTAX_ASCII_FAILED;
-                        Error = true;
+
                     }
                 } else {
-                    reVal = CHECK_START_FAILED;
-                    Error = true;
+                    length    = strlen((const char*)Line);
+                    Continued = (length == MAX_CHAR_EACH_LINE - 1) && (Line[length - 1] != '\n');
                 }
             }
 
             /* Check record end of file */
-            if (reVal == CHECK_FILE_SUCCESSFUL && g_recordEOF == false)
+            if (g_recordEOF == false)
             {
-                reVal = CHECK_EOF_FAILED;
+                RF_Tell(&offset);
+                PF_Add_Error(errorList, lineNumber + 1, offset, CHECK_EOF_FAILED, NULL);
+                if (reVal == CHECK_FILE_SUCCESSFUL)
+                {
+                    reVal = CHECK_EOF_FAILED;
+                } else {
+
+                }
             } else {
                 g_recordEOF = false;
             }
@@ -347,12 +917,6 @@ void PF_Export_Data(const char* fileName, func Print_Address_Data)
 {
     ReadFile_t  openStatus   = FILE_INIT_FAILED;
     uint8_t     Line[MAX_CHAR_EACH_LINE];
-    uint32_t    ABS_Address  = 0;
-    uint32_t    addressField = 0;
-    uint8_t     DataField[MAX_DATA_FIELD];
-    uint16_t    length       = 0;
-    uint8_t     recordType   = 0;
-    uint8_t     byteCount    = 0;
 
     if (fileName != NULL)
     {
@@ -360,34 +924,14 @@ void PF_Export_Data(const char* fileName, func Print_Address_Data)
         openStatus = RF_Init(fileName);
         if (openStatus == FILE_INIT_SUCCESSFUL)
         {
+            /* Addresses are absolute from the start of the file, whatever the last export left */
+            g_typeExtend  = DATA_RECORD;
+            g_valueExtend = 0;
+
             /* Read until meet EOF */
             while((Read_Line(Line) != READ_LINE_FAILED))
             {
-                recordType = convertStrToDec(&Line[START_TYPE_FIELD], 2);
-                length = strlen(Line);
-
-                switch (recordType)
-                {
-                    case DATA_RECORD:
-                        addressField = convertStrToDec(&Line[START_ADD_FIELD], 4);
-                        ABS_Address  = PF_Cal_ABS_Address(addressField);
-                        memset(DataField, 0, MAX_DATA_FIELD);
-                        memcpy(DataField, &Line[START_DATA_FIELD], length - 13);
-                        Print_Address_Data(ABS_Address, DataField); /* Callback here */
-                        break;
-                    case EXTENDED_SEGMENT:
-                        g_typeExtend  = EXTENDED_SEGMENT;
-                        byteCount   = convertStrToDec(&Line[START_BYTE_COUNT_FIELD], 2);
-                        g_valueExtend = convertStrToDec(&Line[START_DATA_FIELD], byteCount * 2);
-                        break;
-                    case EXTENDED_LINEAR:
-                        g_typeExtend  = EXTENDED_LINEAR;
-                        byteCount   = convertStrToDec(&Line[START_BYTE_COUNT_FIELD], 2);
-                        g_valueExtend = convertStrToDec(&Line[START_DATA_FIELD], byteCount * 2);
-                        break;
-                    default:
-                        break;
-                }
+                PF_Handle_Record(Line, Print_Address_Data);
             }
             /* Close file */
             RF_DeInit();
@@ -398,6 +942,113 @@ void PF_Export_Data(const char* fileName, func Print_Address_Data)
         
     }
 }
+
+ParseLine_t PF_Watch_File(const char* fileName, viewFunc Print_Record, errorFunc Print_Error)
+{
+    ParseLine_t reVal = CHECK_FILE_FAILED;
+
+    if ((fileName != NULL) && (Print_Record != NULL) && (Print_Error != NULL))
+    {
+        if (WF_Init(fileName) == WATCH_INIT_SUCCESSFUL)
+        {
+            /* The first pass is an append to an empty file */
+            g_numOfBlock  = 0;
+            g_watchSize   = 0;
+            g_lastOffset  = 0;
+            g_lastType    = DATA_RECORD;
+            g_lastValue   = 0;
+            g_lastID      = 1;
+            g_errorKind   = CHECK_FILE_SUCCESSFUL;
+            PF_Watch_Pass(fileName, Print_Record, Print_Error);
+
+            while (WF_Wait_Change() == WATCH_EVENT_CHANGED)
+            {
+                PF_Watch_Pass(fileName, Print_Record, Print_Error);
+            }
+
+            WF_DeInit();
+            free(g_watchBlock);
+            g_watchBlock = NULL;
+            g_numOfBlock = 0;
+            g_maxBlock   = 0;
+        } else {
+            reVal = CHECK_FILE_FAILED;
+        }
+    } else {
+        reVal = CHECK_FILE_FAILED;
+    }
+
+    return reVal;
+}
+
+ParseLine_t PF_Read_Window(const char* fileName, PF_Cursor_t* cursor, uint32_t numOfRecord, viewFunc Print_Record)
+{
+    ParseLine_t reVal        = CHECK_FILE_SUCCESSFUL;
+    ParseLine_t checkLine    = CHECK_FILE_FAILED;
+    ReadFile_t  openStatus   = FILE_INIT_FAILED;
+    uint8_t     Line[MAX_CHAR_EACH_LINE];
+    uint8_t     Stop         = false;
+
+    if ((fileName != NULL) && (cursor != NULL))
+    {
+        /* Open file */
+        openStatus = RF_Init(fileName);
+        if ((openStatus == FILE_INIT_SUCCESSFUL) && (RF_Seek(cursor->offset) == FILE_SEEK_SUCCESSFUL))
+        {
+            g_typeExtend  = cursor->typeExtend;
+            g_valueExtend = cursor->valueExtend;
+
+            while ((numOfRecord > 0) && (Stop == false))
+            {
+                if (Read_Line(Line) == READ_LINE_FAILED)
+                {
+                    reVal = CHECK_EOF_FAILED;
+                    Stop  = true;
+                } else {
+                    checkLine = PF_Check_Line(Line);
+                    if (checkLine == CHECK_FILE_SUCCESSFUL)
+                    {
+                        if (convertStrToDec(&Line[START_TYPE_FIELD], 2) == DATA_RECORD)
+                        {
+                            if (Print_Record != NULL)
+                            {
+                                PF_View_Record(Line, cursor->ID, Print_Record);
+                            } else {
+
+                            }
+                            cursor->ID++;
+                            numOfRecord--;
+                        } else {
+                            PF_Handle_Record(Line, NULL);
+                        }
+                        RF_Tell(&cursor->offset);
+                    } else {
+                        reVal = checkLine;
+                        Stop  = true;
+                    }
+                }
+            }
+
+            cursor->typeExtend  = g_typeExtend;
+            cursor->valueExtend = g_valueExtend;
+            g_recordEOF = false;
+        } else {
+            reVal = CHECK_FILE_FAILED;
+        }
+
+        /* Close file */
+        if (openStatus == FILE_INIT_SUCCESSFUL)
+        {
+            RF_DeInit();
+        } else {
+
+        }
+    } else {
+        reVal = CHECK_FILE_FAILED;
+    }
+
+    return reVal;
+}
 /*******************************************************************************
  * EOF
  ******************************************************************************/
@@ -0,0 +1,201 @@
+/*
+ * ShmImage.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ShmImage.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+ShmImage_t SI_Get_Generation(const char* shmName, uint32_t* generation)
+{
+    ShmImage_t          reVal   = SHM_OPEN_FAILED;
+    int32_t             fd      = -1;
+    struct stat         status;
+    const IMG_Header_t* pHeader = NULL;
+
+    fd = ((shmName != NULL) && (generation != NULL)) ? shm_open(shmName, O_RDONLY, 0) : -1;
+    if (fd >= 0)
+    {
+        if ((fstat(fd, &status) == 0) && (status.st_size >= (off_t)sizeof(IMG_Header_t)))
+        {
+            pHeader = mmap(NULL, sizeof(IMG_Header_t), PROT_READ, MAP_SHARED, fd, 0);
+            if (pHeader != MAP_FAILED)
+            {
+                if (pHeader->magic == IMG_MAGIC)
+                {
+                    *generation = __atomic_load_n(&pHeader->generation, __ATOMIC_ACQUIRE);
+                    reVal = SHM_OPEN_SUCCESSFUL;
+                } else {
+                    reVal = SHM_OPEN_FAILED;
+                }
+                munmap((void*)pHeader, sizeof(IMG_Header_t));
+            } else {
+                reVal = SHM_OPEN_FAILED;
+            }
+        } else {
+            reVal = SHM_OPEN_FAILED;
+        }
+        close(fd);
+    } else {
+        reVal = SHM_OPEN_FAILED;
+    }
+
+    return reVal;
+}
+
+ShmImage_t SI_Open(const char* shmName, SI_Image_t* image)
+{
+    ShmImage_t          reVal      = SHM_OPEN_FAILED;
+    int32_t             fd         = -1;
+    struct stat         status;
+    uint8_t*            pImage     = NULL;
+    const IMG_Header_t* pHeader    = NULL;
+    uint32_t            generation = 0;
+
+    if ((shmName != NULL) && (image != NULL))
+    {
+        fd = shm_open(shmName, O_RDONLY, 0);
+        if (fd >= 0)
+        {
+            if ((fstat(fd, &status) == 0) && (status.st_size >= (off_t)sizeof(IMG_Header_t)) && (status.st_size <= UINT32_MAX))
+            {
+                pImage = mmap(NULL, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+                if (pImage != MAP_FAILED)
+                {
+                    pHeader    = (const IMG_Header_t*)pImage;
+                    generation = __atomic_load_n(&pHeader->generation, __ATOMIC_ACQUIRE);
+                    if ((pHeader->magic != IMG_MAGIC) || ((generation & 1U) != 0))
+                    {
+                        reVal = SHM_OPEN_BUSY;
+                    } else if ((pHeader->version == IMG_VERSION) && (pHeader->totalSize <= status.st_size) &&
+                               (pHeader->numOfSegment <= (pHeader->totalSize - sizeof(IMG_Header_t)) / sizeof(IMG_Segment_t))) {
+                        image->base       = pImage;
+                        image->size       = status.st_size;
+                        image->generation = generation;
+                        reVal = SHM_OPEN_SUCCESSFUL;
+                    } else {
+                        reVal = SHM_OPEN_FAILED;
+                    }
+
+                    if (reVal != SHM_OPEN_SUCCESSFUL)
+                    {
+                        munmap(pImage, status.st_size);
+                    } else {
+
+                    }
+                } else {
+                    reVal = SHM_OPEN_FAILED;
+                }
+            } else {
+                /* Created but not sized yet by the publisher */
+                reVal = SHM_OPEN_BUSY;
+            }
+            close(fd);
+        } else {
+            reVal = SHM_OPEN_FAILED;
+        }
+    } else {
+        reVal = SHM_OPEN_FAILED;
+    }
+
+    return reVal;
+}
+
+ShmImage_t SI_Close(SI_Image_t* image)
+{
+    ShmImage_t reVal = SHM_CLOSE_FAILED;
+
+    if ((image != NULL) && (image->base != NULL))
+    {
+        munmap((void*)image->base, image->size);
+        image->base = NULL;
+        image->size = 0;
+        reVal = SHM_CLOSE_SUCCESSFUL;
+    } else {
+        reVal = SHM_CLOSE_FAILED;
+    }
+
+    return reVal;
+}
+
+uint32_t SI_Num_Of_Segment(const SI_Image_t* image)
+{
+    uint32_t reVal = 0;
+
+    if ((image != NULL) && (image->base != NULL))
+    {
+        reVal = ((const IMG_Header_t*)image->base)->numOfSegment;
+    } else {
+        reVal = 0;
+    }
+
+    return reVal;
+}
+
+uint32_t SI_Data_Size(const SI_Image_t* image)
+{
+    uint32_t reVal = 0;
+
+    if ((image != NULL) && (image->base != NULL))
+    {
+        reVal = ((const IMG_Header_t*)image->base)->dataSize;
+    } else {
+        reVal = 0;
+    }
+
+    return reVal;
+}
+
+ShmImage_t SI_Get_Segment(const SI_Image_t* image, const uint32_t index, uint32_t* address,
+                          uint32_t* length, const uint8_t** data)
+{
+    ShmImage_t           reVal    = SHM_SEGMENT_FAILED;
+    const IMG_Segment_t* pSegment = NULL;
+
+    if ((index < SI_Num_Of_Segment(image)) && (address != NULL) && (length != NULL) && (data != NULL))
+    {
+        pSegment = (const IMG_Segment_t*)(image->base + sizeof(IMG_Header_t)) + index;
+        if ((pSegment->dataOffset <= image->size) && (pSegment->length <= image->size - pSegment->dataOffset))
+        {
+            *address = pSegment->address;
+            *length  = pSegment->length;
+            *data    = image->base + pSegment->dataOffset;
+            reVal = SHM_SEGMENT_SUCCESSFUL;
+        } else {
+            reVal = SHM_SEGMENT_FAILED;
+        }
+    } else {
+        reVal = SHM_SEGMENT_FAILED;
+    }
+
+    return reVal;
+}
+
+ShmImage_t SI_Is_Current(const char* shmName, const SI_Image_t* image)
+{
+    ShmImage_t reVal      = SHM_IMAGE_OUTDATED;
+    uint32_t   generation = 0;
+
+    if ((shmName != NULL) && (image != NULL) && (SI_Get_Generation(shmName, &generation) == SHM_OPEN_SUCCESSFUL) &&
+        (generation == image->generation))
+    {
+        reVal = SHM_IMAGE_CURRENT;
+    } else {
+        reVal = SHM_IMAGE_OUTDATED;
+    }
+
+    return reVal;
+}
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
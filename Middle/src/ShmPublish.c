@@ -0,0 +1,105 @@
+/*
+ * ShmPublish.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Phong Pham-Thanh
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ShmImage.h"
+#include "ImageFile.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+ShmImage_t SI_Publish(const char* fileName, const char* shmName, uint32_t* generation)
+{
+    ShmImage_t    reVal         = SHM_PUBLISH_FAILED;
+    IMG_Header_t  header;
+    uint32_t      oldGeneration = 0;
+    int32_t       fd            = -1;
+    uint8_t*      pImage        = NULL;
+    IMG_Header_t* pHeader       = NULL;
+
+    if ((fileName != NULL) && (shmName != NULL) && (IMG_Measure(fileName, &header) == IMAGE_BUILD_SUCCESSFUL))
+    {
+        /* Carry the generation over, then detach the old image from the name */
+        if (SI_Get_Generation(shmName, &oldGeneration) == SHM_OPEN_SUCCESSFUL)
+        {
+            shm_unlink(shmName);
+        } else {
+            oldGeneration = 0;
+        }
+        oldGeneration &= ~1U;
+
+        fd = shm_open(shmName, O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (fd >= 0)
+        {
+            if (ftruncate(fd, header.totalSize) == 0)
+            {
+                pImage = mmap(NULL, header.totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (pImage != MAP_FAILED)
+                {
+                    pHeader = (IMG_Header_t*)pImage;
+                    __atomic_store_n(&pHeader->generation, oldGeneration + 1, __ATOMIC_RELEASE); /* Writing */
+                    pHeader->magic = IMG_MAGIC;
+
+                    if (IMG_Build(fileName, pImage, &header) == IMAGE_BUILD_SUCCESSFUL)
+                    {
+                        __atomic_store_n(&pHeader->generation, oldGeneration + 2, __ATOMIC_RELEASE); /* Ready */
+                        if (generation != NULL)
+                        {
+                            *generation = oldGeneration + 2;
+                        } else {
+
+                        }
+                        reVal = SHM_PUBLISH_SUCCESSFUL;
+                    } else {
+                        reVal = SHM_PUBLISH_FAILED;
+                    }
+                    munmap(pImage, header.totalSize);
+                } else {
+                    reVal = SHM_PUBLISH_FAILED;
+                }
+            } else {
+                reVal = SHM_PUBLISH_FAILED;
+            }
+            close(fd);
+
+            if (reVal != SHM_PUBLISH_SUCCESSFUL)
+            {
+                shm_unlink(shmName);
+            } else {
+
+            }
+        } else {
+            reVal = SHM_PUBLISH_FAILED;
+        }
+    } else {
+        reVal = SHM_PUBLISH_FAILED;
+    }
+
+    return reVal;
+}
+
+ShmImage_t SI_Unpublish(const char* shmName)
+{
+    ShmImage_t reVal = SHM_CLOSE_FAILED;
+
+    if ((shmName != NULL) && (shm_unlink(shmName) == 0))
+    {
+        reVal = SHM_CLOSE_SUCCESSFUL;
+    } else {
+        reVal = SHM_CLOSE_FAILED;
+    }
+
+    return reVal;
+}
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
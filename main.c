@@ -2,45 +2,83 @@
  * Includes
  ******************************************************************************/
 #include "APP.h"
+#include <stdlib.h>
 /*******************************************************************************
  * Main
  ******************************************************************************/
 int main(int argc, char** argv) {
-    ParseLine_t checkFile = CHECK_FILE_FAILED;
+    ParseLine_t     checkFile = CHECK_FILE_FAILED;
+    PF_Error_List_t errorList;
+    unsigned long   cacheMiB  = SERVICE_CACHE_MB;
+    char*           End       = NULL;
 
     system("cls");
-    if (argc != 2)
+    if ((argc == 3) && (strcmp(argv[1], "-w") == 0))
     {
-        printf("Usage: %s <file_name>\n", argv[0]);
+        setvbuf(stdout, NULL, _IOLBF, 0); /* Show each record as soon as it is exported */
+        printf("%-5s %-30s %-60s\n", "ID", "Absolute Memory Address", "Data Field");
+        PF_Watch_File(argv[2], APP_Print_Record, APP_Print_Watch_Error); /* Only returns if the watch can't be set up */
+        printf("Error: Can't watch your file\n");
+    } else if ((argc == 3) && (strcmp(argv[1], "-v") == 0)) {
+        APP_View_File(argv[2]); /* Interactive viewer, decodes only the records on screen */
+    } else if ((argc == 4) && (strcmp(argv[1], "-s") == 0)) {
+        checkFile = PF_Check_File(argv[2]); /* Only a valid file is published */
+        if (checkFile == CHECK_FILE_SUCCESSFUL)
+        {
+            APP_Publish_Image(argv[2], argv[3]);
+        } else {
+            APP_Print_Check_Error(checkFile);
+        }
+    } else if ((argc == 3) && (strcmp(argv[1], "-e") == 0)) {
+        checkFile = PF_Collect_Errors(argv[2], &errorList); /* Every failing record in one pass */
+        if (checkFile == CHECK_FILE_SUCCESSFUL)
+        {
+            printf("%-5s %-30s %-60s\n", "ID", "Absolute Memory Address", "Data Field");
+            PF_Export_Data(argv[2], APP_Print_Address_Data);
+        } else if (checkFile == CHECK_FILE_FAILED) {
+            APP_Print_Check_Error(checkFile);
+        } else {
+            APP_Print_Error_List(&errorList);
+        }
+    } else if (((argc == 3) || (argc == 4)) && (strcmp(argv[1], "-d") == 0)) {
+        if (argc == 4)
+        {
+            /* strtoul takes a sign, so only plain digits are let through */
+            cacheMiB = ((argv[3][0] >= '0') && (argv[3][0] <= '9')) ? strtoul(argv[3], &End, 10) : 0;
+            if ((End == NULL) || (*End != '\0') || (cacheMiB > UINT32_MAX / (1024U * 1024U)))
+            {
+                cacheMiB = 0;
+            } else {
+
+            }
+        } else {
+
+        }
+
+        if (cacheMiB != 0)
+        {
+            APP_Serve(argv[2], (uint32_t)cacheMiB * 1024U * 1024U);
+        } else {
+            printf("Usage: %s -d <socket_path> [cache_MiB]\n", argv[0]);
+            printf("       cache_MiB: 1 to %u\n", UINT32_MAX / (1024U * 1024U));
+        }
+    } else if (argc != 2) {
+        printf("Usage: %s [-w | -v | -e] <file_name>\n", argv[0]);
+        printf("       %s -s <file_name> <shm_name>\n", argv[0]);
+        printf("       %s -d <socket_path> [cache_MiB]\n", argv[0]);
+        printf("       -w: keep watching the file and print the records added or changed\n");
+        printf("       -v: browse the file page by page, jump by address or record ID\n");
+        printf("       -e: list every failing record with its line and byte offset\n");
+        printf("       -s: decode the file once and publish it in POSIX shared memory\n");
+        printf("       -d: serve VALIDATE, READ and CRC requests on a Unix socket from cached images\n");
     } else {
         checkFile = PF_Check_File(argv[1]); /* Check input file */
-        switch (checkFile)
+        if (checkFile == CHECK_FILE_SUCCESSFUL)
         {
-            case CHECK_FILE_SUCCESSFUL:
-                printf("%-5s %-30s %-60s\n", "ID", "Absolute Memory Address", "Data Field");
-                PF_Export_Data(argv[1], APP_Print_Address_Data); /* Callback ... to export data to screen */
-                break;
-            case CHECK_START_FAILED:
-                printf("Error: Start Field\n");
-                break;
-            case CHECK_SYNTAX_ASCII_FAILED:
-                printf("Error: Syntax\n");
-                break;
-            case CHECK_SUM_FAILED:
-                printf("Error: Checksum Field\n");
-                break;
-            case CHECK_RECORD_TYPE_FAILED:
-                printf("Error: Type Field\n");
-                break;
-            case CHECK_BYTE_COUNT_FAILED:
-                printf("Error: Bytecount Field\n");
-                break;
-            case CHECK_EOF_FAILED:
-                printf("Error: No Found EOF Record\n");
-                break;
-            default:
-                printf("Error: No found file or can't open your file");
-                break;
+            printf("%-5s %-30s %-60s\n", "ID", "Absolute Memory Address", "Data Field");
+            PF_Export_Data(argv[1], APP_Print_Address_Data); /* Callback ... to export data to screen */
+        } else {
+            APP_Print_Check_Error(checkFile);
         }
     }
 